@@ -3,53 +3,27 @@
 #include <usbcfg.h>
 #include <audio/microphone.h>
 #include <arm_math.h>
-#include <arm_const_structs.h>
 #include <leds.h>
 
 #include "audio_processing.h"
+#include "pitch_detection.h"
 #include "main.h"
 
-
-#define FFT_SIZE 1024
-
-// minimum value of intensity to detect a frequency
-#define MIN_INTENSITY_THRESHOLD 5000
-// we don't analyze before this index to not use resources for nothing
-#define MIN_INDEX 100
-// we don't analyze after this index to not use resources for nothing
-#define MAX_INDEX 500
-#define FREQUENCY_PRECISION 0.765517
-
-// frequency for each string of the guitar and their respective range
-#define SIXTH_STRING_FREQ_MIN 76
-#define SIXTH_STRING_FREQ 82.41f
-#define SIXTH_STRING_FREQ_MAX 88
-
-#define FIFTH_STRING_FREQ_MIN 103
-#define FIFTH_STRING_FREQ 110.00f
-#define FIFTH_STRING_FREQ_MAX 117
-
-#define FOURTH_STRING_FREQ_MIN 138
-#define FOURTH_STRING_FREQ 146.83f
-#define FOURTH_STRING_FREQ_MAX 156
-
-#define THIRD_STRING_FREQ_MIN 184
-#define THIRD_STRING_FREQ 196.00f
-#define THIRD_STRING_FREQ_MAX 208
-
-#define SECOND_STRING_FREQ_MIN 232
-#define SECOND_STRING_FREQ 246.94f
-#define SECOND_STRING_FREQ_MAX 262
-
-#define FIRST_STRING_FREQ_MIN 310
-#define FIRST_STRING_FREQ 329.63f
-#define FIRST_STRING_FREQ_MAX 350
-
-// float array containing the theoretical frequencies of each string of the guitar
-static float string_frequency[] = {FIRST_STRING_FREQ, SECOND_STRING_FREQ, THIRD_STRING_FREQ, FOURTH_STRING_FREQ, FIFTH_STRING_FREQ, SIXTH_STRING_FREQ};
 static float frequency;
 static GUITAR_STRING previous_guitar_string = NO_STRING;
 static GUITAR_STRING guitar_string = NO_STRING;
+// duration of each stage of the detection, for each string detected (NO_STRING included),
+// with a histogram for the decision only (reported by main.c), the other stages have no percentile
+static uint32_t decision_buckets[NO_STRING][LATENCY_BUCKETS];
+static latency_stats_t audio_latency[NO_STRING][NB_AUDIO_STAGES] = {
+    [FIRST_STRING - 1][AUDIO_STAGE_DECISION].buckets = decision_buckets[FIRST_STRING - 1],
+    [SECOND_STRING - 1][AUDIO_STAGE_DECISION].buckets = decision_buckets[SECOND_STRING - 1],
+    [THIRD_STRING - 1][AUDIO_STAGE_DECISION].buckets = decision_buckets[THIRD_STRING - 1],
+    [FOURTH_STRING - 1][AUDIO_STAGE_DECISION].buckets = decision_buckets[FOURTH_STRING - 1],
+    [FIFTH_STRING - 1][AUDIO_STAGE_DECISION].buckets = decision_buckets[FIFTH_STRING - 1],
+    [SIXTH_STRING - 1][AUDIO_STAGE_DECISION].buckets = decision_buckets[SIXTH_STRING - 1],
+    [NO_STRING - 1][AUDIO_STAGE_DECISION].buckets = decision_buckets[NO_STRING - 1],
+};
 
 /*
  *  Input complex buffer for the left microphone.
@@ -60,75 +34,6 @@ static float micLeft_cmplx_input[2 * FFT_SIZE];
 // outupt buffer containing the computed magnitude of the complex numbers
 static float micLeft_output[FFT_SIZE];
 
-/*
- *	Wrapper to call a very optimized fft function provided by ARM.
- *
- *	params :
- *	uint16_t size		        Size of the FFT must be equak to 1024.
- *  float *complex_buffer       Input complex buffer to apply the FFT to.
- */
-void doFFT_optimized(uint16_t size, float *complex_buffer)
-{
-    if (size == 1024)
-        arm_cfft_f32(&arm_cfft_sR_f32_len1024, complex_buffer, 0, 1);
-}
-
-/*
- *	Returns the index associated at the frequency with the highest amplitude.
- *
- *	params :
- *	float *data			outupt buffer containing the computed magnitude
- *                      of the complex numbers. Size: FTT_SIZE.
- */
-uint16_t find_highest_peak(float *data)
-{
-    float max_norm = MIN_INTENSITY_THRESHOLD;
-    int16_t max_norm_index = 0;
-
-    // search for the highest peak
-    for (uint16_t i = MIN_INDEX; i <= MAX_INDEX; i++)
-    {
-        if (data[i] > max_norm)
-        {
-            max_norm = data[i];
-            max_norm_index = i;
-        }
-    }
-    return max_norm_index;
-}
-
-/*
- *	Search and return the string affiliated with the frequency detected.
- */
-GUITAR_STRING find_guitar_string(void)
-{
-    if (frequency > SIXTH_STRING_FREQ_MIN && frequency < SIXTH_STRING_FREQ_MAX)
-    {
-        return SIXTH_STRING;
-    }
-    else if (frequency > FIFTH_STRING_FREQ_MIN && frequency < FIFTH_STRING_FREQ_MAX)
-    {
-        return FIFTH_STRING;
-    }
-    else if (frequency > FOURTH_STRING_FREQ_MIN && frequency < FOURTH_STRING_FREQ_MAX)
-    {
-        return FOURTH_STRING;
-    }
-    else if (frequency > THIRD_STRING_FREQ_MIN && frequency < THIRD_STRING_FREQ_MAX)
-    {
-        return THIRD_STRING;
-    }
-    else if (frequency > SECOND_STRING_FREQ_MIN && frequency < SECOND_STRING_FREQ_MAX)
-    {
-        return SECOND_STRING;
-    }
-    else if (frequency > FIRST_STRING_FREQ_MIN && frequency < FIRST_STRING_FREQ_MAX)
-    {
-        return FIRST_STRING;
-    }
-    return NO_STRING;
-}
-
 /*
  *	Returns the frequency detected.
  */
@@ -150,7 +55,7 @@ GUITAR_STRING get_guitar_string(void)
  */
 float get_string_frequency(void)
 {
-    return string_frequency[guitar_string - 1];
+    return guitar_string_frequency(guitar_string);
 }
 
 /*
@@ -159,7 +64,7 @@ float get_string_frequency(void)
  */
 bool get_pitch(void)
 {
-    if (frequency - string_frequency[guitar_string - 1] >= 0)
+    if (frequency - guitar_string_frequency(guitar_string) >= 0)
     {
         return true;
     }
@@ -169,6 +74,23 @@ bool get_pitch(void)
     }
 }
 
+/*
+ *	Gives the duration of a stage of the detection, for the windows where a
+ *	string was detected, since the start: summary and histogram (see latency.h).
+ *	Only AUDIO_STAGE_DECISION has a histogram and a 99th percentile.
+ *
+ *	params :
+ *	GUITAR_STRING string		String detected, NO_STRING for the windows without string.
+ *	AUDIO_STAGE stage			Stage of the detection.
+ *	latency_report_t *report	Summary of the durations to fill.
+ *	uint32_t *buckets			Array of LATENCY_BUCKETS elements filled with the
+ *								histogram of the durations, or NULL without 99th percentile.
+ */
+void get_audio_latency(GUITAR_STRING string, AUDIO_STAGE stage, latency_report_t *report, uint32_t *buckets)
+{
+    latency_get_report(&audio_latency[string - 1][stage], report, buckets, false);
+}
+
 /*
  *	Callback called when the demodulation of the four microphones is done.
  *	We get 160 samples per mic every 10ms (16kHz)
@@ -185,6 +107,12 @@ void processAudioData(int16_t *data, uint16_t num_samples)
     {
         set_all_rgb_leds(0, 0, 255);
         static uint16_t nb_samples = 0;
+        // arrival of the first block of the window, its samples are at most 10ms older
+        static rtcnt_t window_start = 0;
+        if (nb_samples == 0)
+        {
+            window_start = latency_start();
+        }
 
         /*
          *  Loop to fill the input buffers with the sample for the real part and 0 for the imaginary part.
@@ -207,14 +135,25 @@ void processAudioData(int16_t *data, uint16_t num_samples)
 
         if (nb_samples >= (2 * FFT_SIZE))
         {
+            // duration of each stage, recorded once the string is known
+            uint32_t durations[NB_AUDIO_STAGES];
+            durations[AUDIO_STAGE_FILL] = latency_since(window_start);
+
+            rtcnt_t start = latency_start();
             // This FFT function stores the results in the input buffer given.
             doFFT_optimized(FFT_SIZE, micLeft_cmplx_input);
+            durations[AUDIO_STAGE_FFT] = latency_since(start);
+
+            start = latency_start();
             // Computes the magnitude of the complex numbers and stores them in a buffer of FFT_SIZE
             arm_cmplx_mag_f32(micLeft_cmplx_input, micLeft_output, FFT_SIZE);
+            durations[AUDIO_STAGE_MAGNITUDE] = latency_since(start);
 
+            start = latency_start();
             frequency = find_highest_peak(micLeft_output) * FREQUENCY_PRECISION;
             previous_guitar_string = guitar_string;
-            guitar_string = find_guitar_string();
+            guitar_string = find_guitar_string(frequency);
+            durations[AUDIO_STAGE_CLASSIFICATION] = latency_since(start);
 
             if (guitar_string != NO_STRING)
             {
@@ -243,6 +182,11 @@ void processAudioData(int16_t *data, uint16_t num_samples)
                     break;
                 }
             }
+            durations[AUDIO_STAGE_DECISION] = latency_since(window_start);
+            for (AUDIO_STAGE stage = 0; stage < NB_AUDIO_STAGES; stage++)
+            {
+                latency_record(&audio_latency[guitar_string - 1][stage], durations[stage]);
+            }
             nb_samples = 0;
         }
     }
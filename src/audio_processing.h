@@ -1,23 +1,25 @@
 #ifndef AUDIO_PROCESSING_H
 #define AUDIO_PROCESSING_H
 
-// Different strings of the guitar
+#include "latency.h"
+#include "pitch_detection.h"
+
+// Stages of the detection of a string, their duration is measured for each string detected
 typedef enum
 {
-    FIRST_STRING = 1,
-    SECOND_STRING,
-    THIRD_STRING,
-    FOURTH_STRING,
-    FIFTH_STRING,
-    SIXTH_STRING,
-    NO_STRING
-
-} GUITAR_STRING;
+    AUDIO_STAGE_FILL = 0,        // window of FFT_SIZE samples filled, from its first block
+    AUDIO_STAGE_FFT,             // FFT of the window
+    AUDIO_STAGE_MAGNITUDE,       // magnitude of the spectrum
+    AUDIO_STAGE_CLASSIFICATION,  // peak found and string classified
+    AUDIO_STAGE_DECISION,        // state of the FSM changed, from the first block of the window
+    NB_AUDIO_STAGES,
+} AUDIO_STAGE;
 
 float get_frequency(void);
 GUITAR_STRING get_guitar_string(void);
 float get_string_frequency(void);
 bool get_pitch(void);
 void processAudioData(int16_t *data, uint16_t num_samples);
+void get_audio_latency(GUITAR_STRING string, AUDIO_STAGE stage, latency_report_t *report, uint32_t *buckets);
 
 #endif /* AUDIO_PROCESSING_H */
\ No newline at end of file
@@ -0,0 +1,316 @@
+#include <string.h>
+#include <math.h>
+#include <arm_math.h>
+
+#include "benchmark.h"
+#include "pitch_detection.h"
+#include "line_detection.h"
+#include "pid.h"
+
+// calls of the short kernels in one run, so the resolution of the clock does not matter
+#define SHORT_KERNEL_CALLS 64
+// frequency of the fundamental of the signal of the FFT (in Hz, fifth string) and its amplitude
+#define SIGNAL_FREQUENCY 110.0f
+#define SIGNAL_AMPLITUDE 2000
+#define SIGNAL_HARMONICS 3
+#define SIGNAL_NOISE 200
+// range of the frequencies classified by find_guitar_string (in Hz)
+#define CLASSIFIED_MIN 70.0f
+#define CLASSIFIED_MAX 360.0f
+// columns of the blue and the red lines of the image, and noise of the pixels
+#define BLUE_LINE_BEGIN 180
+#define BLUE_LINE_END 270
+#define RED_LINE_BEGIN 400
+#define RED_LINE_END 490
+#define PIXEL_NOISE 8
+// number of measures of the overhead of the clock
+#define OVERHEAD_SAMPLES 16
+
+// Kernel measured, on the inputs prepared by benchmark_init
+typedef struct
+{
+    const char *name;
+    uint16_t calls;      // calls of the kernel in one run
+    uint32_t bytes;      // bytes of input of one call
+    void (*setup)(void); // restores the input modified by the previous run (not measured), or NULL
+    void (*run)(void);
+} kernel_t;
+
+// signal of the left microphone as filled by processAudioData, and the buffer transformed in place
+static float fft_input[2 * FFT_SIZE];
+static float fft_buffer[2 * FFT_SIZE];
+// spectrum of the signal, and its magnitude
+static float spectrum[2 * FFT_SIZE];
+static float magnitude[FFT_SIZE];
+static float frequencies[SHORT_KERNEL_CALLS];
+
+// COMBINED_LINES lines of the RGB565 image, the line extracted, and its histogram
+static uint8_t image_rgb565[2 * COMBINED_LINES * IMAGE_BUFFER_SIZE];
+static uint8_t image[IMAGE_BUFFER_SIZE];
+static uint16_t histogram[HISTOGRAM_SIZE];
+// green channel of the image, both lines are dark in it, and its mean intensity
+static uint8_t line_image[IMAGE_BUFFER_SIZE];
+static uint32_t line_threshold;
+static line_track_t track = {.reset = true};
+
+static const pid_config_t pid_config = {
+    .kp = 0.5f,
+    .ki = 0.2f,
+    .kd = 0.02f,
+    .kff = 1.0f,
+    .derivative_filter = 0.05f,
+    .deadband = 0,
+    .output_min = -75,
+    .output_max = 75,
+    .period = 0.01f,
+};
+static pid_controller_t pid;
+static float measures[SHORT_KERNEL_CALLS];
+
+// results of the kernels, so the compiler does not remove their calls
+static volatile float sink;
+static uint32_t noise_state = 1;
+
+/*
+ *  Returns a pseudo-random integer inside [-amplitude..amplitude], the same
+ *  sequence at every start (linear congruential generator).
+ *
+ *  params:
+ *  int16_t amplitude       Maximum value.
+ */
+static int16_t noise(int16_t amplitude)
+{
+    noise_state = noise_state * 1664525 + 1013904223;
+    return (int16_t)((noise_state >> 16) % (2 * amplitude + 1)) - amplitude;
+}
+
+/*
+ *  Writes a pixel in RGB565 (big-endian format, as the camera) from its 8 bits channels.
+ *
+ *  params:
+ *  uint8_t *pixel          Two bytes of the pixel.
+ *  uint8_t red, green, blue    Channels of the pixel.
+ */
+static void write_rgb565(uint8_t *pixel, uint8_t red, uint8_t green, uint8_t blue)
+{
+    pixel[0] = (red & 0xF8) | (green >> 5);
+    pixel[1] = ((green & 0x1C) << 3) | (blue >> 3);
+}
+
+/*
+ *  Returns a channel with noise, inside [0..255].
+ *
+ *  params:
+ *  int16_t channel         Channel without noise.
+ */
+static uint8_t noisy_channel(int16_t channel)
+{
+    channel += noise(PIXEL_NOISE);
+    return (channel < 0) ? 0 : ((channel > 255) ? 255 : channel);
+}
+
+// Setup and run of each kernel: the short kernels are called SHORT_KERNEL_CALLS times in one run
+static void setup_fft(void)
+{
+    memcpy(fft_buffer, fft_input, sizeof(fft_buffer));
+}
+
+static void run_fft(void)
+{
+    doFFT_optimized(FFT_SIZE, fft_buffer);
+}
+
+static void run_magnitude(void)
+{
+    arm_cmplx_mag_f32(spectrum, magnitude, FFT_SIZE);
+}
+
+static void run_highest_peak(void)
+{
+    for (uint16_t i = 0; i < SHORT_KERNEL_CALLS; i++)
+    {
+        sink = find_highest_peak(magnitude);
+    }
+}
+
+static void run_guitar_string(void)
+{
+    for (uint16_t i = 0; i < SHORT_KERNEL_CALLS; i++)
+    {
+        sink = find_guitar_string(frequencies[i]);
+    }
+}
+
+static void setup_extraction(void)
+{
+    memset(histogram, 0, sizeof(histogram));
+}
+
+static void run_extract_red(void)
+{
+    sink = extract_color_lines(image_rgb565, image, histogram, IMAGE_BUFFER_SIZE, RED_COLOR, false);
+}
+
+static void run_extract_green(void)
+{
+    sink = extract_color_lines(image_rgb565, image, histogram, IMAGE_BUFFER_SIZE, GREEN_COLOR, false);
+}
+
+static void run_extract_blue(void)
+{
+    sink = extract_color_lines(image_rgb565, image, histogram, IMAGE_BUFFER_SIZE, BLUE_COLOR, false);
+}
+
+static void run_line_detection(void)
+{
+    line_candidate_t candidates[MAX_LINE_CANDIDATES];
+    uint8_t nb_candidates = find_line_candidates(line_image, IMAGE_BUFFER_SIZE, 1, line_threshold, candidates);
+
+    track_line(&track, candidates, nb_candidates);
+    sink = track.line.position;
+}
+
+static void run_pid(void)
+{
+    for (uint16_t i = 0; i < SHORT_KERNEL_CALLS; i++)
+    {
+        sink = pid_update(&pid, IMAGE_BUFFER_SIZE / 2, measures[i], 0);
+    }
+}
+
+static const kernel_t kernels[] = {
+    {"doFFT_optimized", 1, sizeof(fft_buffer), setup_fft, run_fft},
+    {"arm_cmplx_mag_f32", 1, sizeof(spectrum), NULL, run_magnitude},
+    {"find_highest_peak", SHORT_KERNEL_CALLS, sizeof(magnitude), NULL, run_highest_peak},
+    {"find_guitar_string", SHORT_KERNEL_CALLS, 0, NULL, run_guitar_string},
+    {"extract_red", 1, sizeof(image_rgb565), setup_extraction, run_extract_red},
+    {"extract_green", 1, sizeof(image_rgb565), setup_extraction, run_extract_green},
+    {"extract_blue", 1, sizeof(image_rgb565), setup_extraction, run_extract_blue},
+    {"line_detection", 1, sizeof(line_image), NULL, run_line_detection},
+    {"pid_update", SHORT_KERNEL_CALLS, 0, NULL, run_pid},
+};
+
+/*
+ *  Prepares the inputs of the kernels: a plucked string with harmonics and
+ *  noise for the pitch detection, and a RGB565 image of the paper with a blue
+ *  and a red line for the line detection. The inputs are the same at every call.
+ */
+void benchmark_init(void)
+{
+    noise_state = 1;
+    for (uint16_t i = 0; i < FFT_SIZE; i++)
+    {
+        // sampled at FFT_SIZE * FREQUENCY_PRECISION, as the samples used by processAudioData
+        float phase = 2 * PI * SIGNAL_FREQUENCY * i / (FFT_SIZE * FREQUENCY_PRECISION);
+        float sample = noise(SIGNAL_NOISE);
+        for (uint8_t harmonic = 1; harmonic <= SIGNAL_HARMONICS; harmonic++)
+        {
+            sample += SIGNAL_AMPLITUDE / harmonic * sinf(harmonic * phase);
+        }
+        fft_input[2 * i] = (int16_t)sample;
+        fft_input[2 * i + 1] = 0;
+    }
+    memcpy(spectrum, fft_input, sizeof(spectrum));
+    doFFT_optimized(FFT_SIZE, spectrum);
+    arm_cmplx_mag_f32(spectrum, magnitude, FFT_SIZE);
+    for (uint16_t i = 0; i < SHORT_KERNEL_CALLS; i++)
+    {
+        frequencies[i] = CLASSIFIED_MIN + (CLASSIFIED_MAX - CLASSIFIED_MIN) * i / SHORT_KERNEL_CALLS;
+        measures[i] = (float)IMAGE_BUFFER_SIZE * i / SHORT_KERNEL_CALLS;
+    }
+
+    for (uint16_t line = 0; line < COMBINED_LINES; line++)
+    {
+        for (uint16_t i = 0; i < IMAGE_BUFFER_SIZE; i++)
+        {
+            uint8_t *pixel = &image_rgb565[2 * (line * IMAGE_BUFFER_SIZE + i)];
+            if (i >= BLUE_LINE_BEGIN && i < BLUE_LINE_END)
+            {
+                write_rgb565(pixel, noisy_channel(40), noisy_channel(60), noisy_channel(200));
+            }
+            else if (i >= RED_LINE_BEGIN && i < RED_LINE_END)
+            {
+                write_rgb565(pixel, noisy_channel(200), noisy_channel(40), noisy_channel(40));
+            }
+            else
+            {
+                write_rgb565(pixel, noisy_channel(230), noisy_channel(230), noisy_channel(225));
+            }
+        }
+    }
+    memset(histogram, 0, sizeof(histogram));
+    line_threshold = extract_color_lines(image_rgb565, line_image, histogram, IMAGE_BUFFER_SIZE, GREEN_COLOR, false) /
+                     IMAGE_BUFFER_SIZE;
+    track = (line_track_t){.reset = true};
+    pid_init(&pid, &pid_config);
+}
+
+/*
+ *  Returns the number of kernels measured.
+ */
+uint8_t benchmark_count(void)
+{
+    return sizeof(kernels) / sizeof(kernels[0]);
+}
+
+/*
+ *  Returns the smallest time between two consecutive reads of the clock,
+ *  removed from the measures.
+ */
+static uint32_t clock_overhead(benchmark_clock_t clock)
+{
+    uint32_t overhead = UINT32_MAX;
+    for (uint8_t i = 0; i < OVERHEAD_SAMPLES; i++)
+    {
+        uint32_t start = clock();
+        uint32_t ticks = clock() - start;
+        overhead = (ticks < overhead) ? ticks : overhead;
+    }
+    return overhead;
+}
+
+/*
+ *  Measures a kernel: runs it once to warm the caches, then "samples" times,
+ *  each run measured alone. The minimum is the cost of the kernel without
+ *  interruption, the mean includes the interruptions.
+ *
+ *  params:
+ *  uint8_t kernel                  Kernel, from 0 to benchmark_count() - 1.
+ *  uint32_t samples                Number of runs measured, at least 1.
+ *  benchmark_clock_t clock         Clock of the measures.
+ *  benchmark_result_t *result      Measures of one call of the kernel to fill.
+ */
+void benchmark_run(uint8_t kernel, uint32_t samples, benchmark_clock_t clock, benchmark_result_t *result)
+{
+    const kernel_t *measured = &kernels[kernel];
+    uint32_t overhead = clock_overhead(clock);
+    uint32_t min = UINT32_MAX;
+    uint64_t sum = 0;
+
+    samples = (samples > 0) ? samples : 1;
+    if (measured->setup != NULL)
+    {
+        measured->setup();
+    }
+    measured->run();
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        if (measured->setup != NULL)
+        {
+            measured->setup();
+        }
+        uint32_t start = clock();
+        measured->run();
+        uint32_t ticks = clock() - start;
+
+        ticks = (ticks > overhead) ? ticks - overhead : 0;
+        min = (ticks < min) ? ticks : min;
+        sum += ticks;
+    }
+
+    result->name = measured->name;
+    result->samples = samples;
+    result->min = (float)min / measured->calls;
+    result->mean = (float)sum / samples / measured->calls;
+    result->bytes = measured->bytes;
+}
@@ -0,0 +1,30 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+
+/*
+ *  Microbenchmarks of the kernels of the pitch detection, of the line detection
+ *  and of the regulator, on fixed inputs. The same kernels are measured on the
+ *  robot (cycles of the DWT, sent over USB by main.c when built with BENCHMARK=1)
+ *  and on a computer (nanoseconds, see host/bench_main.c).
+ */
+
+// Clock of the measures: cycles on the robot, nanoseconds on a computer (may wrap around)
+typedef uint32_t (*benchmark_clock_t)(void);
+
+// Measures of a kernel, in ticks of the clock for one call of the kernel
+typedef struct
+{
+    const char *name;
+    uint32_t samples; // number of runs measured
+    float min;
+    float mean;
+    uint32_t bytes;   // bytes of input processed by one call, 0 for the kernels without buffer
+} benchmark_result_t;
+
+void benchmark_init(void);
+uint8_t benchmark_count(void);
+void benchmark_run(uint8_t kernel, uint32_t samples, benchmark_clock_t clock, benchmark_result_t *result);
+
+#endif /* BENCHMARK_H */
@@ -0,0 +1,24 @@
+#ifndef CLASS_TABLE_H
+#define CLASS_TABLE_H
+
+#include <stdint.h>
+
+// size of the classification table: 2 bits for each RGB565 color without the LSbit of green (15 bits)
+#define CLASS_TABLE_SIZE ((1 << 15) / 4)
+
+// Classes of the pixels of the playground. The bit 0 is set for the pixels dark in the blue
+// channel (red line, black squares) and the bit 1 for the pixels dark in the red channel
+// (blue line, black squares), so the intensity of a class for a color is a single mask.
+typedef enum
+{
+    PIXEL_PAPER = 0, // white or grey, and any color which is not a line
+    PIXEL_RED,
+    PIXEL_BLUE,
+    PIXEL_DARK,
+} pixel_class_t;
+
+// class of every RGB565 color (without the LSbit of green), 4 classes of 2 bits per byte,
+// generated by src/host/class_table_main.c
+extern const uint8_t class_table[CLASS_TABLE_SIZE];
+
+#endif /* CLASS_TABLE_H */
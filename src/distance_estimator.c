@@ -0,0 +1,186 @@
+#include <ch.h>
+#include <hal.h>
+#include <math.h>
+#include <motors.h>
+
+#include "distance_estimator.h"
+#include "tof_ranging.h"
+#include "motion.h"
+
+// variance added to the estimate by the odometry: per mm travelled (slip) and per update (in mm^2)
+#define ODOMETRY_VARIANCE_PER_MM 0.05f
+#define UPDATE_VARIANCE 0.01f
+// measures further than this number of standard deviations from the estimate are rejected
+#define OUTLIER_GATE 3.0f
+// number of consecutive rejected measures after which the estimate restarts from the measures
+#define MAX_REJECTED 5
+// weight of the velocity of an update in the filtered velocity (1/VELOCITY_FILTER)
+#define VELOCITY_FILTER 8
+// number of updates kept to compensate the age of the measures (10 ms each)
+#define HISTORY_SIZE 32
+
+// estimate of the distance to the wall faced (in mm) and its variance (in mm^2)
+static float distance = 0;
+static float variance = 0;
+// velocity of the distance (in mm/s), negative when going forward
+static float velocity = 0;
+static bool initialized = false;
+
+// time of the restart of the estimation, the estimate starts from a measure ranged after it
+static systime_t reset_time = 0;
+// id of the last measure of the TOF, sum of the positions of the wheels and time at the last update
+static uint32_t last_measure_id = 0;
+static int32_t last_position = 0;
+static systime_t last_time = 0;
+static uint8_t rejected = 0;
+// sum of the positions of the wheels at the last HISTORY_SIZE updates, and their time
+static int32_t position_history[HISTORY_SIZE];
+static systime_t time_history[HISTORY_SIZE];
+static uint8_t history_index = 0;
+static uint8_t history_count = 0;
+
+/*
+ *  Returns the distance travelled forward by the robot since the time given
+ *  (in mm), from the history of the positions of the wheels, or since the
+ *  oldest update kept if the time is older.
+ *
+ *  params:
+ *  systime_t time              Time of a measure.
+ *  int32_t position            Sum of the positions of the wheels now.
+ */
+static float travelled_since(systime_t time, int32_t position)
+{
+    uint8_t index = history_index;
+
+    for (uint8_t i = 0; i < history_count; i++)
+    {
+        // from the newest to the oldest update
+        index = (history_index + HISTORY_SIZE - 1 - i) % HISTORY_SIZE;
+        if ((int32_t)(time - time_history[index]) >= 0)
+        {
+            break;
+        }
+    }
+    return (history_count > 0) ? (position - position_history[index]) / 2.0f * STEP_DISTANCE : 0;
+}
+
+/*
+ *  Restarts the estimation, to call when the wall faced changes (rotation):
+ *  the first measure of the TOF ranged after the reset gives the distance, the
+ *  measures of the previous wall, or ranged during the rotation, are ignored.
+ */
+void distance_estimator_reset(void)
+{
+    reset_time = chVTGetSystemTime();
+    initialized = false;
+}
+
+/*
+ *  Returns true if the estimate of the distance started from a measure of the
+ *  TOF since the last reset.
+ */
+bool distance_estimator_ready(void)
+{
+    return initialized;
+}
+
+/*
+ *  Updates the estimate of the distance, once per control period. The TOF is
+ *  sampled only once, so all the users of the distance see the same value
+ *  during the period. 1-D Kalman filter:
+ *  - prediction: the distance decreases by the distance travelled by the wheels
+ *    since the previous update, its variance grows with the distance travelled
+ *    (slip of the wheels);
+ *  - correction: when the TOF gives a new measure, the estimate moves towards
+ *    the measure by the gain variance / (variance + variance of the measure),
+ *    which depends on the ranging mode. Measures too far from the estimate are
+ *    rejected, unless MAX_REJECTED follow each other.
+ *  A measure gives the distance in the middle of its ranging, older than the
+ *  update: it is compared to the estimate plus the distance travelled since.
+ *  Until the first measure ranged after the reset, there is no estimate.
+ *  Returns true if a new measure of the TOF was used.
+ */
+bool distance_estimator_update(void)
+{
+    tof_measure_t measure;
+    tof_ranging_get_measure(&measure);
+    float measure_variance = tof_ranging_get_variance(measure.mode);
+    int32_t position = left_motor_get_pos() + right_motor_get_pos();
+    systime_t time = chVTGetSystemTime();
+    // middle of the ranging of the measure
+    systime_t measure_time = measure.start + (measure.time - measure.start) / 2;
+
+    if (history_count == 0)
+    {
+        last_position = position;
+        last_time = time;
+    }
+    // odometry: mean of the two wheels, positive forward
+    float travelled = (position - last_position) / 2.0f * STEP_DISTANCE;
+    float dt = ST2MS(time - last_time) / 1000.0f;
+    if (dt > 0)
+    {
+        velocity += (-travelled / dt - velocity) / VELOCITY_FILTER;
+    }
+    last_position = position;
+    last_time = time;
+    position_history[history_index] = position;
+    time_history[history_index] = time;
+    history_index = (history_index + 1) % HISTORY_SIZE;
+    history_count = (history_count < HISTORY_SIZE) ? history_count + 1 : HISTORY_SIZE;
+
+    if (!initialized)
+    {
+        // id 0: no measure since the start of the TOF
+        if (measure.id == 0 || (int32_t)(measure.start - reset_time) < 0)
+        {
+            return false;
+        }
+        distance = measure.distance_mm - travelled_since(measure_time, position);
+        variance = measure_variance;
+        rejected = 0;
+        last_measure_id = measure.id;
+        initialized = true;
+        return true;
+    }
+
+    // prediction with the odometry
+    distance -= travelled;
+    variance += ODOMETRY_VARIANCE_PER_MM * fabsf(travelled) + UPDATE_VARIANCE;
+
+    if (measure.id == last_measure_id)
+    {
+        return false;
+    }
+    last_measure_id = measure.id;
+
+    // correction with the measure, compared to the estimate at the time of the measure
+    float innovation = measure.distance_mm - (distance + travelled_since(measure_time, position));
+    float innovation_variance = variance + measure_variance;
+    if (innovation * innovation > OUTLIER_GATE * OUTLIER_GATE * innovation_variance && ++rejected < MAX_REJECTED)
+    {
+        return false;
+    }
+    rejected = 0;
+    float gain = variance / innovation_variance;
+    distance += gain * innovation;
+    variance *= (1 - gain);
+    return true;
+}
+
+/*
+ *  Returns the estimate of the distance to the wall faced (in mm).
+ */
+float distance_estimator_get_distance(void)
+{
+    return distance;
+}
+
+/*
+ *  Returns the velocity of the distance to the wall faced (in mm/s), negative
+ *  when the robot goes towards the wall.
+ */
+float distance_estimator_get_velocity(void)
+{
+    return velocity;
+}
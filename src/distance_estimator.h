@@ -0,0 +1,10 @@
+#ifndef DISTANCE_ESTIMATOR_H
+#define DISTANCE_ESTIMATOR_H
+
+void distance_estimator_reset(void);
+bool distance_estimator_ready(void);
+bool distance_estimator_update(void);
+float distance_estimator_get_distance(void);
+float distance_estimator_get_velocity(void);
+
+#endif /* DISTANCE_ESTIMATOR_H */
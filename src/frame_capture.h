@@ -0,0 +1,34 @@
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <stdint.h>
+
+#include "line_detection.h"
+
+/*
+ *  Record of a frame sent over USB by the firmware built with CAPTURE=1 (see
+ *  image_processing.c) and replayed on a computer by host/frame_replay: a
+ *  header followed by the CAPTURED_LINES lines of the camera in RGB565, as
+ *  given by dcmi_get_last_image_ptr(). The fields are little-endian.
+ */
+
+// first bytes of a record, to find the records in the stream
+#define FRAME_CAPTURE_MAGIC "LINE"
+#define FRAME_CAPTURE_MAGIC_SIZE 4
+// lines of the camera in a record, and their size in bytes (2 bytes per pixel)
+#define FRAME_CAPTURE_LINES 2
+#define FRAME_CAPTURE_PIXELS_SIZE (FRAME_CAPTURE_LINES * IMAGE_BUFFER_SIZE * 2)
+// the pixels were classified by color (CAPTURE_RGB565_CLASSIFIED) instead of using one channel
+#define FRAME_CAPTURE_CLASSIFIED 0x01
+
+// Header of a record, 12 bytes without padding
+typedef struct
+{
+    char magic[FRAME_CAPTURE_MAGIC_SIZE];
+    uint32_t timestamp_ms; // system time of the capture of the frame
+    uint16_t size;         // bytes of pixels after the header, FRAME_CAPTURE_PIXELS_SIZE
+    uint8_t color;         // color_detection_t followed when the frame was captured
+    uint8_t flags;
+} frame_capture_header_t;
+
+#endif /* FRAME_CAPTURE_H */
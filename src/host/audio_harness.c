@@ -0,0 +1,56 @@
+#include <ch.h>
+
+#include "../main.h"
+#include "../audio_processing.h"
+#include "audio_harness.h"
+
+/*
+ *  Runs the audio processing of the firmware alone (replay, sweep): the FSM of
+ *  the firmware stays in FREQUENCY_DETECTION, so every window is analyzed
+ *  whatever the robot would do after a detection, and the LEDs are not simulated.
+ */
+
+FSM_STATE get_FSM_state(void)
+{
+    return FREQUENCY_DETECTION;
+}
+
+FSM_STATE get_FSM_previous_state(void)
+{
+    return FREQUENCY_DETECTION;
+}
+
+void set_FSM_state(FSM_STATE new_state)
+{
+    (void)new_state;
+}
+
+void increment_FSM_state(void)
+{
+}
+
+void set_all_rgb_leds(uint8_t red_val, uint8_t green_val, uint8_t blue_val)
+{
+    (void)red_val;
+    (void)green_val;
+    (void)blue_val;
+}
+
+void clear_rgb_leds(void)
+{
+}
+
+/*
+ *  Returns the number of windows analyzed by processAudioData since the start.
+ */
+uint32_t audio_windows(void)
+{
+    uint32_t windows = 0;
+    for (GUITAR_STRING string = FIRST_STRING; string <= NO_STRING; string++)
+    {
+        latency_report_t report;
+        get_audio_latency(string, AUDIO_STAGE_DECISION, &report, NULL);
+        windows += report.count;
+    }
+    return windows;
+}
@@ -0,0 +1,8 @@
+#ifndef AUDIO_HARNESS_H
+#define AUDIO_HARNESS_H
+
+#include <stdint.h>
+
+uint32_t audio_windows(void);
+
+#endif /* AUDIO_HARNESS_H */
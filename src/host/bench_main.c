@@ -0,0 +1,290 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../benchmark.h"
+
+/*
+ *  Runs the microbenchmarks of benchmark.c on the computer and prints the time
+ *  of one call of each kernel (in ns) and its throughput. The results can be
+ *  saved and compared with a baseline: a kernel slower than the baseline by more
+ *  than the tolerance is a regression. The results sent over USB by the robot
+ *  built with BENCHMARK=1 (in cycles) have the same format, and can be compared
+ *  with a baseline of the robot without running the kernels on the computer.
+ *
+ *  usage: benchmark [-n samples] [-o results.csv] [-c results.csv] [-b baseline.csv] [-t tolerance]
+ *  -n samples      number of runs measured for each kernel in each round
+ *  -o results.csv  saves the results
+ *  -c results.csv  compares these results (of the robot for example) instead of running the kernels
+ *  -b baseline.csv compares the results with this baseline, exits with a failure on a regression
+ *  -t tolerance    slowdown of the minimum time of a kernel over the baseline tolerated (in %)
+ */
+
+#define DEFAULT_SAMPLES 1000
+// the measures of a computer vary more than the ones of the robot, between runs of a few microseconds
+#define DEFAULT_TOLERANCE 30.0f
+#define MAX_KERNELS 32
+// rounds of measures of all the kernels
+#define ROUNDS 5
+#define MAX_NAME 64
+#define MAX_UNIT 16
+
+// Measures of a kernel, as saved in the CSV files
+typedef struct
+{
+    char name[MAX_NAME];
+    char unit[MAX_UNIT]; // "ns" on a computer, "cycles" on the robot
+    benchmark_result_t result;
+} measure_t;
+
+/*
+ *  Returns the monotonic clock of the computer in ns, it wraps around after 4 s.
+ */
+static uint32_t clock_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000000u + now.tv_nsec);
+}
+
+/*
+ *  Runs every kernel and fills "measures", returns their number. The kernels
+ *  are measured in turn during ROUNDS rounds and the round with the smallest
+ *  minimum is kept, so a slow period of the computer does not fall on only one kernel.
+ *
+ *  params:
+ *  uint32_t samples        Number of runs measured for each kernel in each round.
+ *  measure_t *measures     Array of MAX_KERNELS measures to fill.
+ */
+static uint8_t run_kernels(uint32_t samples, measure_t *measures)
+{
+    uint8_t count = (benchmark_count() < MAX_KERNELS) ? benchmark_count() : MAX_KERNELS;
+
+    benchmark_init();
+    for (uint8_t round = 0; round < ROUNDS; round++)
+    {
+        for (uint8_t kernel = 0; kernel < count; kernel++)
+        {
+            benchmark_result_t result;
+            benchmark_run(kernel, samples, clock_ns, &result);
+            if (round == 0 || result.min < measures[kernel].result.min)
+            {
+                measures[kernel].result = result;
+            }
+        }
+    }
+    for (uint8_t kernel = 0; kernel < count; kernel++)
+    {
+        snprintf(measures[kernel].name, MAX_NAME, "%s", measures[kernel].result.name);
+        snprintf(measures[kernel].unit, MAX_UNIT, "ns");
+        measures[kernel].result.name = measures[kernel].name;
+    }
+    return count;
+}
+
+/*
+ *  Reads the measures of a CSV file "kernel,unit,samples,min,mean,bytes" and
+ *  returns their number, or -1 if the file cannot be opened. The other lines are
+ *  ignored, and the last measure of a kernel is kept (the robot sends the
+ *  results again and again).
+ *
+ *  params:
+ *  const char *path        File to read.
+ *  measure_t *measures     Array of MAX_KERNELS measures to fill.
+ */
+static int read_measures(const char *path, measure_t *measures)
+{
+    FILE *file = fopen(path, "r");
+    char line[256];
+    int count = 0;
+
+    if (file == NULL)
+    {
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        measure_t measure;
+        if (sscanf(line, "%63[^,],%15[^,],%u,%f,%f,%u", measure.name, measure.unit, &measure.result.samples,
+                   &measure.result.min, &measure.result.mean, &measure.result.bytes) != 6)
+        {
+            continue;
+        }
+        int index = 0;
+        while (index < count && strcmp(measures[index].name, measure.name) != 0)
+        {
+            index++;
+        }
+        if (index == MAX_KERNELS)
+        {
+            continue;
+        }
+        measures[index] = measure;
+        measures[index].result.name = measures[index].name;
+        count = (index == count) ? count + 1 : count;
+    }
+    fclose(file);
+    return count;
+}
+
+/*
+ *  Saves the measures in a CSV file, returns false if the file cannot be written.
+ */
+static bool write_measures(const char *path, const measure_t *measures, uint8_t count)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        return false;
+    }
+    fprintf(file, "kernel,unit,samples,min,mean,bytes\n");
+    for (uint8_t i = 0; i < count; i++)
+    {
+        fprintf(file, "%s,%s,%u,%.2f,%.2f,%u\n", measures[i].name, measures[i].unit, measures[i].result.samples,
+                measures[i].result.min, measures[i].result.mean, measures[i].result.bytes);
+    }
+    return fclose(file) == 0;
+}
+
+/*
+ *  Prints the time of one call of each kernel, the number of calls per second
+ *  and the throughput in MB/s of the kernels with an input buffer (on the
+ *  computer only, the frequency of the robot is not known here).
+ */
+static void print_measures(const measure_t *measures, uint8_t count)
+{
+    printf("%-20s %6s %10s %10s %12s %10s\n", "kernel", "unit", "min", "mean", "calls/s", "MB/s");
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const benchmark_result_t *result = &measures[i].result;
+        printf("%-20s %6s %10.1f %10.1f", measures[i].name, measures[i].unit, result->min, result->mean);
+        if (strcmp(measures[i].unit, "ns") == 0 && result->min > 0)
+        {
+            printf(" %12.0f", 1e9 / result->min);
+            if (result->bytes)
+            {
+                printf(" %10.1f", result->bytes * 1e3 / result->min);
+            }
+        }
+        printf("\n");
+    }
+}
+
+/*
+ *  Prints the change of the minimum time of each kernel over the baseline, and
+ *  returns false if a kernel is slower than the baseline by more than the
+ *  tolerance. The kernels measured in another unit or missing are reported.
+ *
+ *  params:
+ *  const measure_t *measures, uint8_t count            Measures to compare.
+ *  const measure_t *baseline, uint8_t baseline_count   Measures of the baseline.
+ *  float tolerance                                     Slowdown tolerated (in %).
+ */
+static bool compare_measures(const measure_t *measures, uint8_t count, const measure_t *baseline, uint8_t baseline_count,
+                             float tolerance)
+{
+    bool success = true;
+
+    printf("\n%-20s %10s %10s %8s\n", "kernel", "baseline", "min", "change");
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const measure_t *reference = NULL;
+        for (uint8_t j = 0; j < baseline_count && reference == NULL; j++)
+        {
+            reference = (strcmp(baseline[j].name, measures[i].name) == 0) ? &baseline[j] : NULL;
+        }
+        if (reference == NULL)
+        {
+            printf("%-20s %10s %10.1f %8s  not in the baseline\n", measures[i].name, "-", measures[i].result.min, "-");
+            continue;
+        }
+        if (strcmp(reference->unit, measures[i].unit) != 0)
+        {
+            printf("%-20s %10s %10s %8s  baseline in %s, measures in %s\n", measures[i].name, "-", "-", "-", reference->unit,
+                   measures[i].unit);
+            continue;
+        }
+
+        float change = (reference->result.min > 0) ? 100 * (measures[i].result.min / reference->result.min - 1) : 0;
+        bool regression = (change > tolerance);
+        success &= !regression;
+        printf("%-20s %10.1f %10.1f %+7.1f%%%s\n", measures[i].name, reference->result.min, measures[i].result.min,
+               change, regression ? "  REGRESSION" : "");
+    }
+    printf("%s (tolerance %.0f%%)\n", success ? "no regression" : "REGRESSION", tolerance);
+    return success;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t samples = DEFAULT_SAMPLES;
+    float tolerance = DEFAULT_TOLERANCE;
+    const char *output_path = NULL;
+    const char *compared_path = NULL;
+    const char *baseline_path = NULL;
+    static measure_t measures[MAX_KERNELS];
+    static measure_t baseline[MAX_KERNELS];
+    int count;
+    int option;
+
+    while ((option = getopt(argc, argv, "n:o:c:b:t:")) != -1)
+    {
+        switch (option)
+        {
+        case 'n':
+            samples = strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            output_path = optarg;
+            break;
+        case 'c':
+            compared_path = optarg;
+            break;
+        case 'b':
+            baseline_path = optarg;
+            break;
+        case 't':
+            tolerance = strtof(optarg, NULL);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n samples] [-o results.csv] [-c results.csv] [-b baseline.csv] [-t tolerance]\n",
+                    argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (compared_path != NULL)
+    {
+        count = read_measures(compared_path, measures);
+        if (count < 0)
+        {
+            fprintf(stderr, "cannot read %s\n", compared_path);
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        count = run_kernels(samples, measures);
+    }
+    print_measures(measures, count);
+
+    if (output_path != NULL && !write_measures(output_path, measures, count))
+    {
+        fprintf(stderr, "cannot write %s\n", output_path);
+        return EXIT_FAILURE;
+    }
+    if (baseline_path != NULL)
+    {
+        int baseline_count = read_measures(baseline_path, baseline);
+        if (baseline_count < 0)
+        {
+            fprintf(stderr, "cannot read %s\n", baseline_path);
+            return EXIT_FAILURE;
+        }
+        return compare_measures(measures, count, baseline, baseline_count, tolerance) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
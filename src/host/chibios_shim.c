@@ -0,0 +1,560 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+
+#include <ch.h>
+#include <hal.h>
+
+#include "chibios_shim.h"
+
+/*
+ *  ChibiOS kernel on the host: the threads of the application run unchanged
+ *  as cooperative threads (ucontext) on a discrete-event virtual clock.
+ *  - A thread runs until it sleeps, waits for a semaphore or a mutex, or wakes
+ *    up a thread of higher priority (preemption, as chSchRescheduleS).
+ *  - The ready threads are ordered by priority, then in FIFO order, like the
+ *    ready list of ChibiOS.
+ *  - When no thread is ready, the clock jumps to the next event: the end of a
+ *    sleep or of a timeout. The events are ordered by time, then by the order
+ *    in which they were set, so the interleaving of the threads only depends on
+ *    the code and a session replays identically.
+ *  The time does not advance while a thread runs: the code takes no time, and
+ *  hours of operation run in seconds.
+ */
+
+// maximum number of threads, and stack of each thread (the working areas are too small on the host)
+#define MAX_THREADS 16
+#define THREAD_STACK_SIZE (256 * 1024)
+// cycles of the realtime counter per tick
+#define CYCLES_PER_TICK (STM32_SYSCLK / CH_CFG_ST_FREQUENCY)
+// FNV-1a hash of the trace of the context switches
+#define TRACE_HASH_INIT 0xcbf29ce484222325ULL
+#define TRACE_HASH_PRIME 0x100000001b3ULL
+
+typedef enum
+{
+    THREAD_READY = 0,
+    THREAD_RUNNING,
+    THREAD_SLEEPING,
+    THREAD_WAIT_SEMAPHORE,
+    THREAD_WAIT_MUTEX,
+    THREAD_FINISHED,
+} thread_state_t;
+
+struct host_thread
+{
+    ucontext_t context;
+    const char *name;
+    uint8_t index;
+    tprio_t prio;
+    tfunc_t function;
+    void *arg;
+    thread_state_t state;
+    thread_t *next;             // next thread of the ready list or of a wait queue
+    threads_queue_t *queue;     // wait queue of the semaphore or mutex waited, NULL otherwise
+    uint32_t event;             // sequence number of its event (end of sleep or timeout), 0 if none
+    msg_t message;              // result of the wait
+};
+
+// End of a sleep or of a timeout
+typedef struct
+{
+    systime_t time;
+    uint32_t sequence;
+    thread_t *thread;
+} event_t;
+
+static thread_t threads[MAX_THREADS];
+static uint8_t nb_threads = 0;
+static thread_t *current = NULL;
+static threads_queue_t ready_list = {NULL};
+// binary heap of the events, ordered by time then sequence
+static event_t events[MAX_THREADS];
+static uint8_t nb_events = 0;
+static uint32_t event_sequence = 0;
+static ucontext_t scheduler_context;
+static systime_t now = 0;
+static bool running = false;
+static host_clock_hook_t clock_hook = NULL;
+static uint64_t trace_hash = TRACE_HASH_INIT;
+static uint32_t context_switches = 0;
+
+/*
+ *  Inserts a thread in a queue ordered by priority. The thread goes after the
+ *  threads of the same priority (FIFO), or before them if "ahead" is set.
+ */
+static void queue_insert(threads_queue_t *queue, thread_t *thread, bool ahead)
+{
+    thread_t **link = &queue->head;
+    while (*link != NULL && ((*link)->prio > thread->prio || (!ahead && (*link)->prio == thread->prio)))
+    {
+        link = &(*link)->next;
+    }
+    thread->next = *link;
+    *link = thread;
+}
+
+/*
+ *  Inserts a thread at the end of a queue, whatever its priority.
+ */
+static void queue_append(threads_queue_t *queue, thread_t *thread)
+{
+    thread_t **link = &queue->head;
+    while (*link != NULL)
+    {
+        link = &(*link)->next;
+    }
+    thread->next = NULL;
+    *link = thread;
+}
+
+static thread_t *queue_remove_head(threads_queue_t *queue)
+{
+    thread_t *thread = queue->head;
+    if (thread != NULL)
+    {
+        queue->head = thread->next;
+        thread->next = NULL;
+    }
+    return thread;
+}
+
+static void queue_remove(threads_queue_t *queue, thread_t *thread)
+{
+    for (thread_t **link = &queue->head; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == thread)
+        {
+            *link = thread->next;
+            thread->next = NULL;
+            return;
+        }
+    }
+}
+
+static bool event_before(const event_t *a, const event_t *b)
+{
+    return (a->time != b->time) ? (a->time < b->time) : (a->sequence < b->sequence);
+}
+
+static void event_swap(uint8_t a, uint8_t b)
+{
+    event_t event = events[a];
+    events[a] = events[b];
+    events[b] = event;
+}
+
+static void event_sift_up(uint8_t i)
+{
+    while (i > 0 && event_before(&events[i], &events[(i - 1) / 2]))
+    {
+        event_swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+static void event_sift_down(uint8_t i)
+{
+    while (true)
+    {
+        uint8_t smallest = i;
+        uint8_t left = 2 * i + 1, right = 2 * i + 2;
+        if (left < nb_events && event_before(&events[left], &events[smallest]))
+        {
+            smallest = left;
+        }
+        if (right < nb_events && event_before(&events[right], &events[smallest]))
+        {
+            smallest = right;
+        }
+        if (smallest == i)
+        {
+            return;
+        }
+        event_swap(i, smallest);
+        i = smallest;
+    }
+}
+
+/*
+ *  Sets the event of the current thread at a time.
+ */
+static void event_set(systime_t time)
+{
+    current->event = ++event_sequence;
+    events[nb_events] = (event_t){.time = time, .sequence = current->event, .thread = current};
+    event_sift_up(nb_events++);
+}
+
+/*
+ *  Removes the event of index i from the heap, and returns it.
+ */
+static event_t event_remove(uint8_t i)
+{
+    event_t event = events[i];
+
+    events[i] = events[--nb_events];
+    if (i < nb_events)
+    {
+        event_sift_up(i);
+        event_sift_down(i);
+    }
+    event.thread->event = 0;
+    return event;
+}
+
+/*
+ *  Cancels the pending event of a thread woken up before its timeout.
+ */
+static void event_cancel(thread_t *thread)
+{
+    for (uint8_t i = 0; i < nb_events; i++)
+    {
+        if (events[i].thread == thread)
+        {
+            event_remove(i);
+            return;
+        }
+    }
+}
+
+/*
+ *  Makes a thread ready, with the result of its wait.
+ */
+static void make_ready(thread_t *thread, msg_t message)
+{
+    if (thread->event)
+    {
+        event_cancel(thread);
+    }
+    thread->state = THREAD_READY;
+    thread->message = message;
+    thread->queue = NULL;
+    queue_insert(&ready_list, thread, false);
+}
+
+/*
+ *  Gives the control back to the scheduler, until the current thread runs again.
+ */
+static void reschedule(void)
+{
+    swapcontext(&current->context, &scheduler_context);
+}
+
+/*
+ *  Lets a thread just woken up run now if its priority is higher than the
+ *  priority of the current thread, which runs again before the threads of its priority.
+ */
+static void preempt_if_needed(void)
+{
+    if (ready_list.head != NULL && ready_list.head->prio > current->prio)
+    {
+        current->state = THREAD_READY;
+        queue_insert(&ready_list, current, true);
+        reschedule();
+    }
+}
+
+/*
+ *  Blocks the current thread in a state, until it is woken up, and returns the result of the wait.
+ */
+static msg_t block(thread_state_t state)
+{
+    current->state = state;
+    reschedule();
+    return current->message;
+}
+
+/*
+ *  Entry point of every thread: the thread is finished when its function returns.
+ */
+static void thread_entry(void)
+{
+    current->function(current->arg);
+    current->state = THREAD_FINISHED;
+    reschedule();
+}
+
+/*
+ *  Jumps to the time of the next event and wakes up the threads of the events
+ *  at that time, in the order of the events. Halts if no thread can ever run.
+ */
+static void advance_clock(void)
+{
+    if (nb_events == 0)
+    {
+        chSysHalt("deadlock: no thread ready and no event pending");
+    }
+
+    systime_t time = events[0].time;
+    if (clock_hook != NULL && time != now)
+    {
+        clock_hook(now, time);
+    }
+    now = time;
+    while (nb_events > 0 && events[0].time == now)
+    {
+        thread_t *thread = event_remove(0).thread;
+        if (thread->queue != NULL)
+        {
+            // timeout of a wait
+            queue_remove(thread->queue, thread);
+            make_ready(thread, MSG_TIMEOUT);
+        }
+        else
+        {
+            make_ready(thread, MSG_OK);
+        }
+    }
+}
+
+/*
+ *  Sets the function called before each jump of the virtual clock.
+ */
+void host_set_clock_hook(host_clock_hook_t hook)
+{
+    clock_hook = hook;
+}
+
+/*
+ *  Runs the threads created until host_stop is called.
+ */
+void host_run(void)
+{
+    running = true;
+    while (running)
+    {
+        thread_t *thread = queue_remove_head(&ready_list);
+        if (thread == NULL)
+        {
+            advance_clock();
+            continue;
+        }
+
+        // the trace is the sequence of the threads run and of their time
+        trace_hash = (trace_hash ^ now) * TRACE_HASH_PRIME;
+        trace_hash = (trace_hash ^ thread->index) * TRACE_HASH_PRIME;
+        context_switches++;
+
+        current = thread;
+        thread->state = THREAD_RUNNING;
+        swapcontext(&scheduler_context, &thread->context);
+        current = NULL;
+    }
+}
+
+/*
+ *  Stops host_run when the running thread blocks.
+ */
+void host_stop(void)
+{
+    running = false;
+}
+
+/*
+ *  Returns the name of the running thread.
+ */
+const char *host_thread_name(void)
+{
+    return (current != NULL && current->name != NULL) ? current->name : "host";
+}
+
+/*
+ *  Returns the hash of the trace of the context switches since the start:
+ *  two runs with the same inputs have the same hash.
+ */
+uint64_t host_trace_hash(void)
+{
+    return trace_hash;
+}
+
+uint32_t host_context_switches(void)
+{
+    return context_switches;
+}
+
+void chSysInit(void)
+{
+}
+
+void chSysLock(void)
+{
+}
+
+void chSysUnlock(void)
+{
+}
+
+void chSysHalt(const char *reason)
+{
+    fprintf(stderr, "halt at %u ms in %s: %s\n", (unsigned)now, host_thread_name(), reason);
+    exit(EXIT_FAILURE);
+}
+
+rtcnt_t chSysGetRealtimeCounterX(void)
+{
+    return (rtcnt_t)((uint64_t)now * CYCLES_PER_TICK);
+}
+
+thread_t *chThdCreateStatic(void *wsp, size_t size, tprio_t prio, tfunc_t pf, void *arg)
+{
+    (void)wsp;
+    (void)size;
+    if (nb_threads == MAX_THREADS)
+    {
+        chSysHalt("too many threads");
+    }
+    thread_t *thread = &threads[nb_threads];
+
+    thread->index = nb_threads++;
+    thread->prio = prio;
+    thread->function = pf;
+    thread->arg = arg;
+    getcontext(&thread->context);
+    thread->context.uc_stack.ss_sp = malloc(THREAD_STACK_SIZE);
+    thread->context.uc_stack.ss_size = THREAD_STACK_SIZE;
+    thread->context.uc_link = NULL;
+    makecontext(&thread->context, thread_entry, 0);
+    make_ready(thread, MSG_OK);
+    if (current != NULL)
+    {
+        preempt_if_needed();
+    }
+    return thread;
+}
+
+void chRegSetThreadName(const char *name)
+{
+    current->name = name;
+}
+
+void chThdSleep(systime_t time)
+{
+    if (time == TIME_IMMEDIATE)
+    {
+        chThdYield();
+        return;
+    }
+    event_set(now + time);
+    block(THREAD_SLEEPING);
+}
+
+void chThdSleepMilliseconds(uint32_t msec)
+{
+    chThdSleep(MS2ST(msec));
+}
+
+void chThdSleepSeconds(uint32_t sec)
+{
+    chThdSleep(S2ST(sec));
+}
+
+void chThdSleepUntil(systime_t time)
+{
+    chThdSleep(time - now);
+}
+
+systime_t chThdSleepUntilWindowed(systime_t prev, systime_t next)
+{
+    // sleeps only if the current time is still inside the window
+    if (now - prev < next - prev)
+    {
+        chThdSleep(next - now);
+    }
+    return next;
+}
+
+void chThdYield(void)
+{
+    current->state = THREAD_READY;
+    queue_insert(&ready_list, current, false);
+    reschedule();
+}
+
+bool chThdShouldTerminateX(void)
+{
+    return !running;
+}
+
+systime_t chVTGetSystemTime(void)
+{
+    return now;
+}
+
+systime_t chVTGetSystemTimeX(void)
+{
+    return now;
+}
+
+void chBSemObjectInit(binary_semaphore_t *bsp, bool taken)
+{
+    bsp->taken = taken;
+    bsp->queue.head = NULL;
+}
+
+msg_t chBSemWaitTimeout(binary_semaphore_t *bsp, systime_t time)
+{
+    if (!bsp->taken)
+    {
+        bsp->taken = true;
+        return MSG_OK;
+    }
+    if (time == TIME_IMMEDIATE)
+    {
+        return MSG_TIMEOUT;
+    }
+    queue_append(&bsp->queue, current);
+    current->queue = &bsp->queue;
+    if (time != TIME_INFINITE)
+    {
+        event_set(now + time);
+    }
+    return block(THREAD_WAIT_SEMAPHORE);
+}
+
+msg_t chBSemWait(binary_semaphore_t *bsp)
+{
+    return chBSemWaitTimeout(bsp, TIME_INFINITE);
+}
+
+void chBSemSignal(binary_semaphore_t *bsp)
+{
+    thread_t *thread = queue_remove_head(&bsp->queue);
+    if (thread == NULL)
+    {
+        bsp->taken = false;
+        return;
+    }
+    // the semaphore stays taken, by the thread woken up
+    make_ready(thread, MSG_OK);
+    preempt_if_needed();
+}
+
+void chMtxObjectInit(mutex_t *mp)
+{
+    mp->owner = NULL;
+    mp->queue.head = NULL;
+}
+
+void chMtxLock(mutex_t *mp)
+{
+    if (mp->owner == NULL)
+    {
+        mp->owner = current;
+        return;
+    }
+    queue_insert(&mp->queue, current, false);
+    current->queue = &mp->queue;
+    block(THREAD_WAIT_MUTEX);
+}
+
+void chMtxUnlock(mutex_t *mp)
+{
+    thread_t *thread = queue_remove_head(&mp->queue);
+    mp->owner = thread;
+    if (thread != NULL)
+    {
+        make_ready(thread, MSG_OK);
+        preempt_if_needed();
+    }
+}
@@ -0,0 +1,16 @@
+#ifndef CHIBIOS_SHIM_H
+#define CHIBIOS_SHIM_H
+
+#include <ch.h>
+
+// function called before the virtual clock jumps from "from" to "to", to simulate the world in between
+typedef void (*host_clock_hook_t)(systime_t from, systime_t to);
+
+void host_set_clock_hook(host_clock_hook_t hook);
+void host_run(void);
+void host_stop(void);
+const char *host_thread_name(void);
+uint64_t host_trace_hash(void);
+uint32_t host_context_switches(void);
+
+#endif /* CHIBIOS_SHIM_H */
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../class_table.h"
+
+/*
+ *  Generates class_table.c, the table of the class of every RGB565 color used
+ *  by the classified capture mode (see extract_color_lines), so the table is
+ *  a constant in the flash of the robot instead of being computed at the start
+ *  in its RAM. "make class-table" writes ../class_table.c again.
+ *
+ *  usage: class_table
+ */
+
+// a pixel with all its channels under this intensity is dark (black square of the junctions)
+#define CLASS_DARK_MAX 70
+// minimum difference between the highest and the lowest channel of a colored pixel
+#define CLASS_SATURATION_MIN 60
+// bytes of the table written on each line
+#define BYTES_PER_LINE 16
+
+/*
+ *  Returns the class of a RGB565 color. A pixel is dark if all its channels
+ *  are low, white or grey (paper) if its channels are close to each other,
+ *  otherwise its class is its strongest channel.
+ *
+ *  params:
+ *  uint16_t index          Color on 15 bits: 5 bits of red, 5 MSbits of green, 5 bits of blue.
+ */
+static pixel_class_t classify_color(uint16_t index)
+{
+    // channels on 8 bits
+    uint8_t red = (index >> 10) << 3;
+    uint8_t green = ((index >> 5) & 0x1F) << 3;
+    uint8_t blue = (index & 0x1F) << 3;
+    uint8_t max = (red > green) ? red : green;
+    uint8_t min = (red < green) ? red : green;
+
+    max = (blue > max) ? blue : max;
+    min = (blue < min) ? blue : min;
+    if (max < CLASS_DARK_MAX)
+    {
+        return PIXEL_DARK;
+    }
+    if (max - min >= CLASS_SATURATION_MIN)
+    {
+        if (red == max)
+        {
+            return PIXEL_RED;
+        }
+        if (blue == max)
+        {
+            return PIXEL_BLUE;
+        }
+    }
+    return PIXEL_PAPER;
+}
+
+int main(void)
+{
+    printf("// Generated by src/host/class_table_main.c (\"make -C src/host class-table\"), do not edit.\n");
+    printf("// Class of every RGB565 color, see class_table.h.\n\n");
+    printf("#include \"class_table.h\"\n\n");
+    printf("const uint8_t class_table[CLASS_TABLE_SIZE] = {");
+    for (uint16_t byte = 0; byte < CLASS_TABLE_SIZE; byte++)
+    {
+        uint8_t classes = 0;
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            classes |= classify_color(byte * 4 + i) << (i * 2);
+        }
+        printf("%s0x%02x,", (byte % BYTES_PER_LINE) ? " " : "\n    ", classes);
+    }
+    printf("\n};\n");
+    return EXIT_SUCCESS;
+}
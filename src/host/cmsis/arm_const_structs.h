@@ -0,0 +1,8 @@
+#ifndef HOST_ARM_CONST_STRUCTS_H
+#define HOST_ARM_CONST_STRUCTS_H
+
+#include <arm_math.h>
+
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024;
+
+#endif /* HOST_ARM_CONST_STRUCTS_H */
@@ -0,0 +1,111 @@
+#include <math.h>
+
+#include <arm_math.h>
+#include <arm_const_structs.h>
+
+/*
+ *  Portable C version of the functions of CMSIS-DSP used by the application.
+ */
+
+static float32_t twiddle_1024[1024];
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len1024 = {.fftLen = 1024, .pTwiddle = twiddle_1024};
+
+/*
+ *  Fills the table of the twiddle factors of an FFT, once: the butterflies
+ *  then read their factor instead of computing a cosine and a sine.
+ */
+static void fill_twiddles(const arm_cfft_instance_f32 *S)
+{
+    // cos(0) is 1 once the table is filled
+    if (S->pTwiddle[0] != 0)
+    {
+        return;
+    }
+    for (uint16_t k = 0; k < S->fftLen / 2; k++)
+    {
+        S->pTwiddle[2 * k] = cos(2 * M_PI * k / S->fftLen);
+        S->pTwiddle[2 * k + 1] = sin(2 * M_PI * k / S->fftLen);
+    }
+}
+
+/*
+ *  Reorders the complex samples in the bit reversed order of their index.
+ */
+static void bit_reverse(float32_t *buffer, uint16_t length)
+{
+    for (uint16_t i = 1, j = 0; i < length; i++)
+    {
+        uint16_t bit = length >> 1;
+        for (; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j)
+        {
+            float32_t real = buffer[2 * i], imag = buffer[2 * i + 1];
+            buffer[2 * i] = buffer[2 * j];
+            buffer[2 * i + 1] = buffer[2 * j + 1];
+            buffer[2 * j] = real;
+            buffer[2 * j + 1] = imag;
+        }
+    }
+}
+
+/*
+ *  In-place complex FFT (radix-2, decimation in time) of S->fftLen samples
+ *  [real0, imag0, real1, imag1, ...]. The inverse FFT is scaled by 1 / fftLen
+ *  like in CMSIS-DSP. Without bit reversal, the output stays in bit reversed order.
+ */
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+    uint16_t length = S->fftLen;
+    float32_t sign = ifftFlag ? 1.0f : -1.0f;
+
+    fill_twiddles(S);
+    // decimation in time works on the samples in bit reversed order
+    bit_reverse(p1, length);
+    for (uint16_t size = 2; size <= length; size <<= 1)
+    {
+        // the factors of a stage of size points are every length / size factors of the table
+        uint16_t stride = length / size;
+        for (uint16_t k = 0; k < size / 2; k++)
+        {
+            float32_t twiddle_real = S->pTwiddle[2 * k * stride];
+            float32_t twiddle_imag = sign * S->pTwiddle[2 * k * stride + 1];
+            for (uint16_t start = k; start < length; start += size)
+            {
+                float32_t *even = &p1[2 * start];
+                float32_t *odd = &p1[2 * (start + size / 2)];
+                float32_t real = odd[0] * twiddle_real - odd[1] * twiddle_imag;
+                float32_t imag = odd[0] * twiddle_imag + odd[1] * twiddle_real;
+                odd[0] = even[0] - real;
+                odd[1] = even[1] - imag;
+                even[0] += real;
+                even[1] += imag;
+            }
+        }
+    }
+    if (!bitReverseFlag)
+    {
+        bit_reverse(p1, length);
+    }
+    if (ifftFlag)
+    {
+        for (uint32_t i = 0; i < 2u * length; i++)
+        {
+            p1[i] /= length;
+        }
+    }
+}
+
+/*
+ *  Magnitude of numSamples complex numbers [real0, imag0, real1, imag1, ...].
+ */
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples)
+{
+    for (uint32_t i = 0; i < numSamples; i++)
+    {
+        pDst[i] = sqrtf(pSrc[2 * i] * pSrc[2 * i] + pSrc[2 * i + 1] * pSrc[2 * i + 1]);
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef HOST_ARM_MATH_H
+#define HOST_ARM_MATH_H
+
+/*
+ *  Subset of CMSIS-DSP used by the application, implemented in portable C by
+ *  arm_math.c (same results, not the same speed). Used by the host build in
+ *  place of CMSIS-DSP (see makefile).
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+typedef float float32_t;
+
+#ifndef PI
+#define PI 3.14159265358979f
+#endif
+
+// Complex FFT of fftLen points (power of 2), with its table of fftLen / 2 twiddle factors
+// [cos0, sin0, cos1, sin1, ...] of the angles 2 * PI * k / fftLen, filled at its first FFT
+typedef struct
+{
+    uint16_t fftLen;
+    float32_t *pTwiddle;
+} arm_cfft_instance_f32;
+
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+void arm_cmplx_mag_f32(const float32_t *pSrc, float32_t *pDst, uint32_t numSamples);
+
+#endif /* HOST_ARM_MATH_H */
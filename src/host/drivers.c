@@ -0,0 +1,694 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <ch.h>
+#include <hal.h>
+#include <chprintf.h>
+#include <usbcfg.h>
+#include <motors.h>
+#include <leds.h>
+#include <spi_comm.h>
+#include <memory_protection.h>
+#include <camera/po8030.h>
+#include <i2c_bus.h>
+#include <camera/dcmi_camera.h>
+#include <sensors/VL53L0X/VL53L0X.h>
+#include <audio/microphone.h>
+
+#include "playground.h"
+#include "drivers.h"
+
+/*
+ *  Drivers of the e-puck2 library on the host: the motors move the robot on
+ *  the playground, the TOF and the camera measure the playground and the
+ *  microphones hear the guitar.
+ */
+
+// distance travelled by a wheel for one step of the motor (in mm)
+#define STEP_DISTANCE 0.13f
+// motions of the robot kept for the TOF, which measures during its timing budget
+#define MOTION_HISTORY 256
+// time between two frames of the camera while streaming (in ms)
+#define FRAME_PERIOD 66
+// exposure time giving the full intensity to a white ground (in lines of the sensor), and exposure
+// time reached by the automatic exposure of the sensor with the reference light (inversely proportional to the light)
+#define EXPOSURE_REFERENCE 256.0f
+#define AUTO_EXPOSURE 230.0f
+// standard deviation of the noise of the pixels (8 bits intensity)
+#define PIXEL_NOISE 3.0f
+// size of the image buffers: 640 x 480 pixels in RGB565 at most
+#define MAX_IMAGE_SIZE (2 * SENSOR_WIDTH * SENSOR_HEIGHT)
+/*
+ *  The firmware converts the index of the bins of the FFT into a frequency
+ *  with FREQUENCY_PRECISION (0.765517 Hz), calibrated on the robot: the signal
+ *  is sampled at the frequency it implies (1024 samples of 1 out of 20 samples).
+ */
+#define MIC_SAMPLE_RATE (0.765517f * 1024 * 20)
+// samples of each microphone in a block of MIC_BUFFER_LEN, every 10 ms
+#define MIC_BLOCK_SAMPLES (MIC_BUFFER_LEN / 4)
+// amplitude of the fundamental, relative amplitude of the harmonics and decay of a plucked string
+#define PLUCK_AMPLITUDE 4000.0f
+#define PLUCK_DECAY 3.0f
+#define MIC_NOISE 50.0f
+static const float harmonics[] = {1.0f, 0.35f, 0.15f};
+
+SerialDriver SD3;
+static USBDriver USBD1 = {.state = USB_STOP};
+static const SerialUSBConfig serusbcfg = {.usbp = &USBD1};
+SerialUSBDriver SDU1 = {.config = &serusbcfg};
+
+static uint32_t random_state = 1;
+static float illumination = 1.0f;
+static uint8_t rgb_led[NUM_RGB_LED][3];
+
+// Motion of the robot between two jumps of the clock, the speeds of the motors are constant
+typedef struct
+{
+    systime_t start;
+    pose_t pose;
+    int16_t speed[2];
+} motion_t;
+
+static int16_t motor_speed[2];
+static float motor_position[2];
+
+static motion_t motion_history[MOTION_HISTORY];
+static uint32_t nb_motions = 0;
+static systime_t tof_start = 0;
+static uint16_t tof_budget = 33;
+static float tof_noise = 4.0f;
+static bool tof_measuring = false;
+static uint32_t tof_last_index = 0;
+static uint32_t tof_cleared_index = 0;
+
+static format_t camera_format = FORMAT_RGB565;
+static uint16_t window_x1 = 0, window_y1 = 0, window_width = SENSOR_WIDTH, window_height = 2;
+static uint8_t window_sub_x = 1, window_sub_y = 1;
+static bool camera_auto_exposure = true;
+static float camera_exposure = AUTO_EXPOSURE;
+static uint8_t camera_bank = 0;
+static uint8_t *image_buffers[2] = {NULL, NULL};
+static uint8_t last_buffer = 0;
+static bool streaming = false;
+static systime_t next_frame = 0;
+
+static mic_callback_t mic_callback = NULL;
+static float pluck_frequency = 0;
+static uint32_t pluck_sample = 0;
+static uint32_t mic_sample = 0;
+
+/*
+ *  Returns a pseudo-random number uniform in [0, 1[ (xorshift), deterministic for a given seed.
+ */
+static float random_uniform(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return (random_state >> 8) / (float)(1 << 24);
+}
+
+/*
+ *  Returns a pseudo-random number of a normal distribution (Box-Muller).
+ *
+ *  params:
+ *  float deviation         Standard deviation.
+ */
+static float random_normal(float deviation)
+{
+    float u = random_uniform();
+    float v = random_uniform();
+    return deviation * sqrtf(-2.0f * logf(1.0f - u)) * cosf(2 * M_PI * v);
+}
+
+void drivers_set_usb(bool active)
+{
+    USBD1.state = active ? USB_ACTIVE : USB_STOP;
+}
+
+void drivers_set_seed(uint32_t seed)
+{
+    random_state = seed ? seed : 1;
+}
+
+/*
+ *  Sets the light on the playground, relative to the light of the reference exposure.
+ */
+void drivers_set_illumination(float light)
+{
+    illumination = light;
+}
+
+/*
+ *  Moves the robot with the speed of the motors, called before each jump of
+ *  the virtual clock: the speeds do not change in between.
+ */
+void drivers_advance(systime_t from, systime_t to)
+{
+    float dt = ST2MS(to - from) / 1000.0f;
+
+    motion_history[nb_motions++ % MOTION_HISTORY] = (motion_t){.start = from, .pose = playground_get_pose(),
+                                                                .speed = {motor_speed[0], motor_speed[1]}};
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        motor_position[i] += motor_speed[i] * dt;
+    }
+    playground_move(motor_speed[0] * STEP_DISTANCE, motor_speed[1] * STEP_DISTANCE, dt);
+}
+
+/*
+ *  Returns the pose of the robot at a past time, from the motion in progress at that time.
+ */
+static pose_t pose_at(systime_t time)
+{
+    if (time >= chVTGetSystemTime())
+    {
+        return playground_get_pose();
+    }
+    const motion_t *motion = NULL;
+    for (uint32_t i = nb_motions; i > 0 && nb_motions - i < MOTION_HISTORY; i--)
+    {
+        motion = &motion_history[(i - 1) % MOTION_HISTORY];
+        if (motion->start <= time)
+        {
+            return playground_integrate(motion->pose, motion->speed[0] * STEP_DISTANCE, motion->speed[1] * STEP_DISTANCE,
+                                        ST2MS(time - motion->start) / 1000.0f);
+        }
+    }
+    // older than the history, the oldest pose is given
+    return (motion != NULL) ? motion->pose : playground_get_pose();
+}
+
+/*
+ *  Starts the sound of a string plucked at a frequency.
+ */
+void drivers_pluck(float frequency)
+{
+    pluck_frequency = frequency;
+    pluck_sample = mic_sample;
+}
+
+void drivers_mute(void)
+{
+    pluck_frequency = 0;
+}
+
+/*
+ *  Copies the color of the first RGB LED, all the LEDs have the same color in the firmware.
+ */
+void drivers_get_rgb_led(uint8_t *red, uint8_t *green, uint8_t *blue)
+{
+    *red = rgb_led[LED2][0];
+    *green = rgb_led[LED2][1];
+    *blue = rgb_led[LED2][2];
+}
+
+/* ---------------------------------------------------------------------------
+ *  Communications and LEDs
+ */
+
+void halInit(void)
+{
+}
+
+void sdStart(SerialDriver *sdp, const SerialConfig *config)
+{
+    (void)sdp;
+    (void)config;
+}
+
+void usb_start(void)
+{
+}
+
+void mpu_init(void)
+{
+}
+
+void spi_comm_start(void)
+{
+}
+
+int chprintf(BaseSequentialStream *chp, const char *fmt, ...)
+{
+    (void)chp;
+    va_list args;
+    va_start(args, fmt);
+    int count = vprintf(fmt, args);
+    va_end(args);
+    return count;
+}
+
+size_t chSequentialStreamWrite(BaseSequentialStream *chp, const uint8_t *bp, size_t n)
+{
+    (void)chp;
+    return fwrite(bp, 1, n, stdout);
+}
+
+void clear_leds(void)
+{
+    memset(rgb_led, 0, sizeof(rgb_led));
+}
+
+void set_led(led_name_t led_number, unsigned int value)
+{
+    (void)led_number;
+    (void)value;
+}
+
+void set_rgb_led(rgb_led_name_t led_number, uint8_t red_val, uint8_t green_val, uint8_t blue_val)
+{
+    rgb_led[led_number][0] = red_val;
+    rgb_led[led_number][1] = green_val;
+    rgb_led[led_number][2] = blue_val;
+}
+
+/* ---------------------------------------------------------------------------
+ *  Motors: index 0 is the left motor, 1 the right motor
+ */
+
+void motors_init(void)
+{
+    memset(motor_speed, 0, sizeof(motor_speed));
+    memset(motor_position, 0, sizeof(motor_position));
+}
+
+static int16_t limit_speed(int speed)
+{
+    return (speed > MOTOR_SPEED_LIMIT) ? MOTOR_SPEED_LIMIT : ((speed < -MOTOR_SPEED_LIMIT) ? -MOTOR_SPEED_LIMIT : speed);
+}
+
+void left_motor_set_speed(int speed)
+{
+    motor_speed[0] = limit_speed(speed);
+}
+
+void right_motor_set_speed(int speed)
+{
+    motor_speed[1] = limit_speed(speed);
+}
+
+int32_t left_motor_get_pos(void)
+{
+    return (int32_t)motor_position[0];
+}
+
+int32_t right_motor_get_pos(void)
+{
+    return (int32_t)motor_position[1];
+}
+
+void left_motor_set_pos(int32_t counter_value)
+{
+    motor_position[0] = counter_value;
+}
+
+void right_motor_set_pos(int32_t counter_value)
+{
+    motor_position[1] = counter_value;
+}
+
+/* ---------------------------------------------------------------------------
+ *  TOF: a measure is given at the end of each timing budget, from the pose of
+ *  the robot in the middle of the budget, with the noise of the accuracy mode.
+ *  The end of a measure sets the data ready flag, until the interrupt is cleared.
+ */
+
+VL53L0X_Error VL53L0X_init(VL53L0X_Dev_t *device)
+{
+    device->Data.LastRangeMeasure.RangeMilliMeter = 0;
+    return VL53L0X_ERROR_NONE;
+}
+
+VL53L0X_Error VL53L0X_configAccuracy(VL53L0X_Dev_t *device, VL53L0X_AccuracyMode accuracy)
+{
+    (void)device;
+    switch (accuracy)
+    {
+    case VL53L0X_HIGH_SPEED:
+        tof_budget = 20;
+        tof_noise = 5.0f;
+        break;
+    case VL53L0X_HIGH_ACCURACY:
+        tof_budget = 200;
+        tof_noise = 2.0f;
+        break;
+    case VL53L0X_LONG_RANGE:
+        tof_budget = 33;
+        tof_noise = 4.0f;
+        break;
+    default:
+        tof_budget = 30;
+        tof_noise = 4.0f;
+        break;
+    }
+    return VL53L0X_ERROR_NONE;
+}
+
+VL53L0X_Error VL53L0X_GetMeasurementTimingBudgetMicroSeconds(VL53L0X_Dev_t *device, uint32_t *pMeasurementTimingBudgetMicroSeconds)
+{
+    (void)device;
+    *pMeasurementTimingBudgetMicroSeconds = tof_budget * 1000;
+    return VL53L0X_ERROR_NONE;
+}
+
+VL53L0X_Error VL53L0X_startMeasure(VL53L0X_Dev_t *device, VL53L0X_DeviceModes mode)
+{
+    (void)device;
+    (void)mode;
+    tof_start = chVTGetSystemTime();
+    tof_last_index = 0;
+    tof_cleared_index = 0;
+    tof_measuring = true;
+    return VL53L0X_ERROR_NONE;
+}
+
+VL53L0X_Error VL53L0X_getLastMeasure(VL53L0X_Dev_t *device)
+{
+    if (!tof_measuring)
+    {
+        return VL53L0X_ERROR_CONTROL_INTERFACE;
+    }
+    // index of the last measure finished, the same measure is read until the next one
+    uint32_t index = (chVTGetSystemTime() - tof_start) / tof_budget;
+    if (index > tof_last_index)
+    {
+        systime_t middle = tof_start + index * tof_budget - tof_budget / 2;
+        pose_t pose = pose_at(middle);
+        float range = playground_tof_range(&pose) + random_normal(tof_noise);
+        device->Data.LastRangeMeasure.RangeMilliMeter = (range > 0) ? (uint16_t)lroundf(range) : 0;
+        tof_last_index = index;
+    }
+    return VL53L0X_ERROR_NONE;
+}
+
+VL53L0X_Error VL53L0X_GetMeasurementDataReady(VL53L0X_Dev_t *device, uint8_t *pMeasurementDataReady)
+{
+    (void)device;
+    if (!tof_measuring)
+    {
+        return VL53L0X_ERROR_CONTROL_INTERFACE;
+    }
+    *pMeasurementDataReady = (chVTGetSystemTime() - tof_start) / tof_budget > tof_cleared_index;
+    return VL53L0X_ERROR_NONE;
+}
+
+VL53L0X_Error VL53L0X_ClearInterruptMask(VL53L0X_Dev_t *device, uint32_t InterruptMask)
+{
+    (void)device;
+    (void)InterruptMask;
+    tof_cleared_index = (chVTGetSystemTime() - tof_start) / tof_budget;
+    return VL53L0X_ERROR_NONE;
+}
+
+VL53L0X_Error VL53L0X_stopMeasure(VL53L0X_Dev_t *device)
+{
+    (void)device;
+    tof_measuring = false;
+    return VL53L0X_ERROR_NONE;
+}
+
+/* ---------------------------------------------------------------------------
+ *  Camera: the window configured is rendered from the pose of the robot at
+ *  the end of each frame, in the format configured
+ */
+
+void po8030_start(void)
+{
+}
+
+int8_t po8030_advanced_config(format_t fmt, uint16_t x1, uint16_t y1, uint16_t width, uint16_t height,
+                              subsampling_t subsampling_x, subsampling_t subsampling_y)
+{
+    camera_format = fmt;
+    window_x1 = x1;
+    window_y1 = y1;
+    window_width = width;
+    window_height = height;
+    // the register value gives the factor in its low nibble
+    window_sub_x = subsampling_x & 0x0F;
+    window_sub_y = subsampling_y & 0x0F;
+    return 0;
+}
+
+/*
+ *  Returns the exposure time of the sensor (in lines of the sensor): the one
+ *  written by the firmware, or the one reached by the automatic exposure.
+ */
+static float sensor_exposure(void)
+{
+    return camera_auto_exposure ? AUTO_EXPOSURE / illumination : camera_exposure;
+}
+
+int8_t po8030_set_ae(uint8_t ae)
+{
+    // the sensor keeps the exposure reached by its automatic exposure
+    camera_exposure = sensor_exposure();
+    camera_auto_exposure = ae;
+    return 0;
+}
+
+int8_t po8030_set_awb(uint8_t awb)
+{
+    (void)awb;
+    return 0;
+}
+
+int8_t po8030_set_exposure(uint16_t integral, uint8_t fractional)
+{
+    if (!camera_auto_exposure)
+    {
+        camera_exposure = integral + fractional / 256.0f;
+    }
+    return 0;
+}
+
+uint32_t po8030_get_image_size(void)
+{
+    uint8_t bytes_per_pixel = (camera_format == FORMAT_YYYY) ? 1 : 2;
+    return (window_width / window_sub_x) * (window_height / window_sub_y) * bytes_per_pixel;
+}
+
+/* ---------------------------------------------------------------------------
+ *  I2C: only the registers of the integration time of the camera are read
+ */
+
+void i2c_start(void)
+{
+}
+
+int8_t write_reg(uint8_t addr, uint8_t reg, uint8_t value)
+{
+    if (addr == PO8030_ADDR && reg == REG_BANK)
+    {
+        camera_bank = value;
+    }
+    return MSG_OK;
+}
+
+int8_t read_reg(uint8_t addr, uint8_t reg, uint8_t *value)
+{
+    // in 1/256 line
+    uint32_t exposure = sensor_exposure() * 256;
+
+    if (addr != PO8030_ADDR || camera_bank != BANK_B)
+    {
+        return MSG_TIMEOUT;
+    }
+    switch (reg)
+    {
+    case PO8030_REG_INTTIME_H:
+        *value = exposure >> 16;
+        return MSG_OK;
+    case PO8030_REG_INTTIME_M:
+        *value = exposure >> 8;
+        return MSG_OK;
+    case PO8030_REG_INTTIME_L:
+        *value = exposure;
+        return MSG_OK;
+    default:
+        return MSG_TIMEOUT;
+    }
+}
+
+void dcmi_start(void)
+{
+}
+
+int8_t dcmi_prepare(void)
+{
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        if (image_buffers[i] == NULL)
+        {
+            image_buffers[i] = calloc(MAX_IMAGE_SIZE, 1);
+        }
+    }
+    return 0;
+}
+
+int8_t dcmi_unprepare(void)
+{
+    return 0;
+}
+
+void dcmi_enable_double_buffering(void)
+{
+}
+
+void dcmi_disable_double_buffering(void)
+{
+}
+
+void dcmi_set_capture_mode(uint8_t mode)
+{
+    (void)mode;
+}
+
+void dcmi_capture_start(void)
+{
+    streaming = true;
+    next_frame = chVTGetSystemTime() + FRAME_PERIOD;
+}
+
+int8_t dcmi_capture_stop(void)
+{
+    streaming = false;
+    return 0;
+}
+
+/*
+ *  Returns the intensity of a channel seen by the sensor, from 0 to 255.
+ */
+static uint8_t sensor_intensity(float reflectance, float gain)
+{
+    float intensity = reflectance * gain * 255 + random_normal(PIXEL_NOISE);
+    return (intensity > 255) ? 255 : ((intensity < 0) ? 0 : (uint8_t)intensity);
+}
+
+/*
+ *  Renders the window configured into a buffer, from the pose of the robot.
+ */
+static void render_image(uint8_t *buffer)
+{
+    pose_t pose = playground_get_pose();
+    float gain = illumination * sensor_exposure() / EXPOSURE_REFERENCE;
+    uint16_t width = window_width / window_sub_x;
+    uint16_t height = window_height / window_sub_y;
+
+    for (uint16_t row = 0; row < height; row++)
+    {
+        for (uint16_t column = 0; column < width; column++)
+        {
+            // center of the pixels sampled by the subsampling
+            reflectance_t pixel = playground_camera_pixel(&pose, window_x1 + (column + 0.5f) * window_sub_x,
+                                                          window_y1 + (row + 0.5f) * window_sub_y);
+            uint8_t red = sensor_intensity(pixel.r, gain);
+            uint8_t green = sensor_intensity(pixel.g, gain);
+            uint8_t blue = sensor_intensity(pixel.b, gain);
+            uint32_t index = row * width + column;
+            if (camera_format == FORMAT_YYYY)
+            {
+                buffer[index] = (uint8_t)(0.299f * red + 0.587f * green + 0.114f * blue);
+            }
+            else
+            {
+                // RGB565, big-endian
+                buffer[2 * index] = (red & 0xF8) | (green >> 5);
+                buffer[2 * index + 1] = ((green << 3) & 0xE0) | (blue >> 3);
+            }
+        }
+    }
+}
+
+/*
+ *  Waits for the end of the next frame and renders it in the other buffer.
+ */
+void wait_image_ready(void)
+{
+    if (!streaming)
+    {
+        dcmi_capture_start();
+    }
+    systime_t now = chVTGetSystemTime();
+    if ((int32_t)(next_frame - now) > 0)
+    {
+        chThdSleep(next_frame - now);
+    }
+    else
+    {
+        // frames missed while the image was processed
+        next_frame += ((now - next_frame) / FRAME_PERIOD) * FRAME_PERIOD;
+    }
+    next_frame += FRAME_PERIOD;
+
+    last_buffer ^= 1;
+    render_image(image_buffers[last_buffer]);
+}
+
+uint8_t image_is_ready(void)
+{
+    return streaming && chVTGetSystemTime() >= next_frame;
+}
+
+uint8_t *dcmi_get_last_image_ptr(void)
+{
+    return image_buffers[last_buffer];
+}
+
+/* ---------------------------------------------------------------------------
+ *  Microphones: the 4 microphones hear the same plucked string, with noise
+ */
+
+/*
+ *  Returns the next sample of the sound of the string plucked.
+ */
+static int16_t mic_signal(void)
+{
+    float sample = random_normal(MIC_NOISE);
+    if (pluck_frequency > 0)
+    {
+        // time since the string was plucked
+        float time = (mic_sample - pluck_sample) / MIC_SAMPLE_RATE;
+        float envelope = PLUCK_AMPLITUDE * expf(-time / PLUCK_DECAY);
+        for (uint8_t h = 0; h < sizeof(harmonics) / sizeof(harmonics[0]); h++)
+        {
+            sample += envelope * harmonics[h] * sinf(2 * M_PI * (h + 1) * pluck_frequency * time);
+        }
+    }
+    return (int16_t)fmaxf(fminf(sample, INT16_MAX), INT16_MIN);
+}
+
+static THD_WORKING_AREA(waMicrophones, 256);
+static THD_FUNCTION(Microphones, arg)
+{
+    chRegSetThreadName(__FUNCTION__);
+    (void)arg;
+
+    static int16_t data[MIC_BUFFER_LEN];
+    systime_t time = chVTGetSystemTime();
+
+    while (1)
+    {
+        time = chThdSleepUntilWindowed(time, time + MS2ST(10));
+        for (uint16_t i = 0; i < MIC_BLOCK_SAMPLES; i++)
+        {
+            int16_t sample = mic_signal();
+            mic_sample++;
+            data[4 * i + MIC_RIGHT] = sample;
+            data[4 * i + MIC_LEFT] = sample;
+            data[4 * i + MIC_BACK] = sample;
+            data[4 * i + MIC_FRONT] = sample;
+        }
+        mic_callback(data, MIC_BUFFER_LEN);
+    }
+}
+
+void mic_start(mic_callback_t fct)
+{
+    mic_callback = fct;
+    chThdCreateStatic(waMicrophones, sizeof(waMicrophones), NORMALPRIO, Microphones, NULL);
+}
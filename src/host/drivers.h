@@ -0,0 +1,14 @@
+#ifndef DRIVERS_H
+#define DRIVERS_H
+
+#include <ch.h>
+
+void drivers_set_usb(bool active);
+void drivers_set_seed(uint32_t seed);
+void drivers_set_illumination(float illumination);
+void drivers_advance(systime_t from, systime_t to);
+void drivers_pluck(float frequency);
+void drivers_mute(void);
+void drivers_get_rgb_led(uint8_t *red, uint8_t *green, uint8_t *blue);
+
+#endif /* DRIVERS_H */
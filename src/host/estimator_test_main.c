@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include <ch.h>
+#include <motors.h>
+
+#include "../distance_estimator.h"
+#include "../tof_ranging.h"
+#include "../motion.h"
+
+/*
+ *  Unit test of distance_estimator.c, linked alone with stubs of the clock, of
+ *  the step counters of the motors and of the TOF, so each case sets exactly
+ *  the time, the position of the wheels and the measure seen by the estimator:
+ *  - no estimate before the first measure of the TOF (id 0);
+ *  - after a reset, a measure ranged before the reset is ignored, and the
+ *    first measure ranged after it gives the distance;
+ *  - the age of a measure is compensated with the distance travelled since
+ *    the middle of its ranging;
+ *  - the velocity follows the odometry.
+ *  "make check" builds and runs it, with the other checks of the host build.
+ *
+ *  usage: estimator_test
+ */
+
+// period of the updates, as the control loop of motion.c (in ms)
+#define UPDATE_PERIOD 10
+// tolerance of the distances (in mm) and of the velocities (in mm/s) compared
+#define TOLERANCE 0.01f
+
+static systime_t now = 0;
+// steps of each wheel
+static int32_t wheel_position = 0;
+static tof_measure_t tof_measure = {.id = 0};
+static int failures = 0;
+
+systime_t chVTGetSystemTime(void)
+{
+    return now;
+}
+
+int32_t left_motor_get_pos(void)
+{
+    return wheel_position;
+}
+
+int32_t right_motor_get_pos(void)
+{
+    return wheel_position;
+}
+
+void tof_ranging_get_measure(tof_measure_t *measure)
+{
+    *measure = tof_measure;
+}
+
+float tof_ranging_get_variance(ranging_mode_t mode)
+{
+    (void)mode;
+    return 16.0f;
+}
+
+/*
+ *  Gives a new measure of the TOF, ranged from start to time.
+ *
+ *  params:
+ *  uint16_t distance_mm        Distance measured.
+ *  systime_t start             Start of the ranging.
+ *  systime_t time              Reading of the measure.
+ */
+static void give_measure(uint16_t distance_mm, systime_t start, systime_t time)
+{
+    tof_measure.distance_mm = distance_mm;
+    tof_measure.id++;
+    tof_measure.mode = RANGING_LONG_RANGE;
+    tof_measure.start = start;
+    tof_measure.time = time;
+}
+
+/*
+ *  Advances the time by one period while the wheels move by the steps given,
+ *  then updates the estimator. Returns its result.
+ *
+ *  params:
+ *  int32_t steps               Steps of each wheel during the period, positive forward.
+ */
+static bool step(int32_t steps)
+{
+    now += UPDATE_PERIOD;
+    wheel_position += steps;
+    return distance_estimator_update();
+}
+
+/*
+ *  Prints the result of a check and counts the failures.
+ *
+ *  params:
+ *  bool passed                 Result of the check.
+ *  const char *name            Description of the check.
+ */
+static void check(bool passed, const char *name)
+{
+    printf("%s: %s\n", passed ? "pass" : "FAIL", name);
+    failures += !passed;
+}
+
+int main(void)
+{
+    // no measure since the start of the TOF
+    step(0);
+    check(!distance_estimator_ready(), "no estimate before the first measure");
+
+    give_measure(300, now - 5, now);
+    check(step(0) && distance_estimator_ready(), "first measure used");
+    check(fabsf(distance_estimator_get_distance() - 300) < TOLERANCE, "distance of the first measure");
+
+    // measure of the previous wall, ranged before the reset
+    step(0);
+    distance_estimator_reset();
+    give_measure(200, now - 20, now);
+    check(!step(0) && !distance_estimator_ready(), "measure ranged before the reset ignored");
+
+    give_measure(150, now - 5, now);
+    check(step(0) && distance_estimator_ready(), "measure ranged after the reset used");
+    check(fabsf(distance_estimator_get_distance() - 150) < TOLERANCE, "distance of the measure after the reset");
+
+    // second reset: no estimate until a newer measure
+    distance_estimator_reset();
+    check(!step(0) && !distance_estimator_ready(), "no estimate after a second reset");
+
+    // forward at 10 steps per period (1.3 mm), measure ranged during the 4 next periods: its
+    // middle is 3 periods before the update which reads it
+    systime_t start = now;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        step(10);
+    }
+    give_measure(400, start, now);
+    check(step(10) && fabsf(distance_estimator_get_distance() - (400 - 3 * 10 * STEP_DISTANCE)) < TOLERANCE,
+          "first measure compensated by the distance travelled since its ranging");
+
+    // a measure equal to the estimate at the middle of its ranging corrects it by less than its rounding
+    start = now;
+    step(10);
+    step(10);
+    float expected = distance_estimator_get_distance();
+    step(10);
+    step(10);
+    give_measure((uint16_t)lroundf(expected), start, now);
+    step(10);
+    check(fabsf(distance_estimator_get_distance() - (expected - 3 * 10 * STEP_DISTANCE)) < 0.5f,
+          "measure compared to the estimate at the middle of its ranging");
+
+    // the filtered velocity converges to the speed of the wheels, negative forward
+    for (uint8_t i = 0; i < 100; i++)
+    {
+        step(10);
+    }
+    check(fabsf(distance_estimator_get_velocity() + 10 * STEP_DISTANCE * 1000 / UPDATE_PERIOD) < TOLERANCE,
+          "velocity of the odometry");
+
+    printf("%d failure(s)\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../frame_capture.h"
+#include "../line_detection.h"
+
+/*
+ *  Replays the frames sent over USB by the firmware built with CAPTURE=1 (see
+ *  frame_capture.h) through the extraction, the line detection and the tracking
+ *  of line_detection.c, as image_processing.c with the threshold THRESHOLD_MEAN.
+ *  The bytes before a record (the stream captured from its middle, or text) are
+ *  skipped. For each frame, the line detected and the processing time are
+ *  written as CSV lines:
+ *  frame,time_ms,color,found,position,width,contrast,candidates,processing_us
+ *  (position in pixel, with the sub-pixel precision of the tracking). A summary
+ *  is printed on the error output.
+ *
+ *  usage: frame_replay [-c color] [-o results.csv] capture
+ *  -c color        r, g or b: replays every frame with this color instead of the color captured
+ *  -o results.csv  writes the CSV lines in this file instead of the standard output
+ */
+
+// frames further apart are from another streaming of the camera, which restarts the tracking (in ms)
+#define STREAM_GAP_MS 500
+// size of frame_capture_header_t as sent by the robot
+#define HEADER_SIZE 12
+
+/*
+ *  Returns the monotonic clock of the computer in ns.
+ */
+static uint64_t clock_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+}
+
+/*
+ *  Returns a little-endian integer of "size" bytes read in a buffer.
+ */
+static uint32_t read_le(const uint8_t *buffer, uint8_t size)
+{
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < size; i++)
+    {
+        value |= (uint32_t)buffer[i] << (8 * i);
+    }
+    return value;
+}
+
+/*
+ *  Reads the next record of the capture: searches its magic, then reads its
+ *  header and its pixels. Returns false at the end of the capture.
+ *
+ *  params:
+ *  FILE *file                          Capture read.
+ *  frame_capture_header_t *header      Header to fill.
+ *  uint8_t *pixels                     Buffer of FRAME_CAPTURE_PIXELS_SIZE bytes to fill.
+ *  uint32_t *skipped                   Number of bytes skipped, updated.
+ */
+static bool read_record(FILE *file, frame_capture_header_t *header, uint8_t *pixels, uint32_t *skipped)
+{
+    uint8_t bytes[HEADER_SIZE];
+    uint8_t matched = 0;
+    int c;
+
+    while ((c = fgetc(file)) != EOF)
+    {
+        if (c != FRAME_CAPTURE_MAGIC[matched])
+        {
+            // the byte may start the magic
+            *skipped += matched;
+            matched = (c == FRAME_CAPTURE_MAGIC[0]) ? 1 : 0;
+            *skipped += 1 - matched;
+            continue;
+        }
+        bytes[matched++] = c;
+        if (matched < FRAME_CAPTURE_MAGIC_SIZE)
+        {
+            continue;
+        }
+
+        matched = 0;
+        if (fread(bytes + FRAME_CAPTURE_MAGIC_SIZE, 1, HEADER_SIZE - FRAME_CAPTURE_MAGIC_SIZE, file) !=
+            HEADER_SIZE - FRAME_CAPTURE_MAGIC_SIZE)
+        {
+            return false;
+        }
+        memcpy(header->magic, bytes, FRAME_CAPTURE_MAGIC_SIZE);
+        header->timestamp_ms = read_le(bytes + 4, 4);
+        header->size = read_le(bytes + 8, 2);
+        header->color = bytes[10];
+        header->flags = bytes[11];
+        if (header->size != FRAME_CAPTURE_PIXELS_SIZE || header->color > BLUE_COLOR)
+        {
+            // not a record, the magic was in the pixels or in text
+            *skipped += HEADER_SIZE;
+            continue;
+        }
+        return fread(pixels, 1, FRAME_CAPTURE_PIXELS_SIZE, file) == FRAME_CAPTURE_PIXELS_SIZE;
+    }
+    *skipped += matched;
+    return false;
+}
+
+/*
+ *  Runs the extraction, the detection and the tracking on every frame of the
+ *  capture and writes a CSV line for each one. Prints the summary on the error output.
+ *
+ *  params:
+ *  FILE *file              Capture read.
+ *  int color               Color replayed, or -1 for the color of each frame.
+ *  FILE *output            CSV output.
+ */
+static void replay(FILE *file, int color, FILE *output)
+{
+    static uint8_t pixels[FRAME_CAPTURE_PIXELS_SIZE];
+    uint8_t image[IMAGE_BUFFER_SIZE];
+    uint16_t histogram[HISTOGRAM_SIZE];
+    line_candidate_t candidates[MAX_LINE_CANDIDATES];
+    line_track_t track = {.line.position = (IMAGE_BUFFER_SIZE / 2) << LINE_POSITION_SHIFT, .reset = true};
+    frame_capture_header_t header;
+    uint32_t frames = 0, lines_found = 0, tracks = 0, skipped = 0, jitter_frames = 0;
+    // previous frame, to restart the tracking and to measure the jitter of the position
+    uint32_t previous_time = 0;
+    int previous_color = -1;
+    bool previous_found = false;
+    float previous_position = 0;
+    float jitter = 0;
+    uint64_t total_ns = 0, max_ns = 0;
+
+    fprintf(output, "frame,time_ms,color,found,position,width,contrast,candidates,processing_us\n");
+    while (read_record(file, &header, pixels, &skipped))
+    {
+        color_detection_t frame_color = (color >= 0) ? (color_detection_t)color : (color_detection_t)header.color;
+        if ((int)frame_color != previous_color || header.timestamp_ms - previous_time > STREAM_GAP_MS)
+        {
+            // as select_color_detection or a restart of the camera
+            track.reset = true;
+        }
+        previous_color = frame_color;
+        previous_time = header.timestamp_ms;
+
+        uint64_t start = clock_ns();
+        memset(histogram, 0, sizeof(histogram));
+        uint32_t sum = extract_color_lines(pixels, image, histogram, IMAGE_BUFFER_SIZE, frame_color,
+                                           header.flags & FRAME_CAPTURE_CLASSIFIED);
+        uint8_t nb_candidates = find_line_candidates(image, IMAGE_BUFFER_SIZE, 1, sum / IMAGE_BUFFER_SIZE, candidates);
+        uint8_t previous_id = track.id;
+        track_line(&track, candidates, nb_candidates);
+        uint64_t elapsed = clock_ns() - start;
+
+        bool found = (track.id != 0);
+        float position = (float)track.line.position / (1 << LINE_POSITION_SHIFT);
+        frames++;
+        lines_found += found;
+        tracks += (found && track.id != previous_id);
+        if (found && previous_found)
+        {
+            jitter += (position > previous_position) ? position - previous_position : previous_position - position;
+            jitter_frames++;
+        }
+        previous_found = found;
+        previous_position = position;
+        total_ns += elapsed;
+        max_ns = (elapsed > max_ns) ? elapsed : max_ns;
+
+        fprintf(output, "%u,%u,%d,%d,%.2f,%u,%u,%u,%.2f\n", frames, header.timestamp_ms, frame_color, found, position,
+                found ? track.line.width : 0, found ? track.line.contrast : 0, nb_candidates, elapsed / 1000.0);
+    }
+
+    fprintf(stderr, "%u frames, %u with a line (%u tracks), %u bytes skipped\n", frames, lines_found, tracks, skipped);
+    if (frames > 0)
+    {
+        fprintf(stderr, "processing per frame: mean %.2f us, max %.2f us\n", total_ns / 1000.0 / frames, max_ns / 1000.0);
+    }
+    if (jitter_frames > 0)
+    {
+        fprintf(stderr, "mean variation of the position between two frames: %.2f px\n", jitter / jitter_frames);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *output_path = NULL;
+    int color = -1;
+    int option;
+
+    while ((option = getopt(argc, argv, "c:o:")) != -1)
+    {
+        switch (option)
+        {
+        case 'c':
+            color = (optarg[0] == 'r') ? RED_COLOR : (optarg[0] == 'g') ? GREEN_COLOR : (optarg[0] == 'b') ? BLUE_COLOR : -2;
+            break;
+        case 'o':
+            output_path = optarg;
+            break;
+        default:
+            optind = argc;
+            break;
+        }
+    }
+    if (optind != argc - 1 || color == -2)
+    {
+        fprintf(stderr, "usage: %s [-c r|g|b] [-o results.csv] capture\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    FILE *file = fopen(argv[optind], "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", argv[optind]);
+        return EXIT_FAILURE;
+    }
+    FILE *output = (output_path != NULL) ? fopen(output_path, "w") : stdout;
+    if (output == NULL)
+    {
+        fprintf(stderr, "cannot write %s\n", output_path);
+        return EXIT_FAILURE;
+    }
+    replay(file, color, output);
+    fclose(file);
+    return (fclose(output) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,17 @@
+#ifndef HOST_MICROPHONE_H
+#define HOST_MICROPHONE_H
+
+#include <stdint.h>
+
+#define MIC_RIGHT 0
+#define MIC_LEFT 1
+#define MIC_BACK 2
+#define MIC_FRONT 3
+// samples given at each call of the callback: 160 samples of the 4 microphones, every 10 ms
+#define MIC_BUFFER_LEN 640
+
+typedef void (*mic_callback_t)(int16_t *data, uint16_t num_samples);
+
+void mic_start(mic_callback_t fct);
+
+#endif /* HOST_MICROPHONE_H */
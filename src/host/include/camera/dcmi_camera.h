@@ -0,0 +1,22 @@
+#ifndef HOST_DCMI_CAMERA_H
+#define HOST_DCMI_CAMERA_H
+
+#include <ch.h>
+#include <hal.h>
+
+#define CAPTURE_ONE_SHOT 0
+#define CAPTURE_CONTINUOUS 1
+
+void dcmi_start(void);
+int8_t dcmi_prepare(void);
+int8_t dcmi_unprepare(void);
+void dcmi_enable_double_buffering(void);
+void dcmi_disable_double_buffering(void);
+void dcmi_set_capture_mode(uint8_t mode);
+void dcmi_capture_start(void);
+int8_t dcmi_capture_stop(void);
+void wait_image_ready(void);
+uint8_t image_is_ready(void);
+uint8_t *dcmi_get_last_image_ptr(void);
+
+#endif /* HOST_DCMI_CAMERA_H */
@@ -0,0 +1,38 @@
+#ifndef HOST_PO8030_H
+#define HOST_PO8030_H
+
+#include <stdint.h>
+
+typedef enum
+{
+    FORMAT_CBYCRY = 0x00,
+    FORMAT_RGB565 = 0x44,
+    FORMAT_YYYY = 0x41,
+} format_t;
+
+// register values of the subsampling
+typedef enum
+{
+    SUBSAMPLING_X1 = 0x11,
+    SUBSAMPLING_X2 = 0x22,
+    SUBSAMPLING_X4 = 0x44,
+} subsampling_t;
+
+#define PO8030_ADDR 0x6E
+// register of the bank of the registers
+#define REG_BANK 0x03
+#define BANK_B 0x01
+// integration time in the bank B: integral part in lines on 16 bits, fractional part in 1/256 line
+#define PO8030_REG_INTTIME_H 0x17
+#define PO8030_REG_INTTIME_M 0x18
+#define PO8030_REG_INTTIME_L 0x19
+
+void po8030_start(void);
+int8_t po8030_advanced_config(format_t fmt, uint16_t x1, uint16_t y1, uint16_t width, uint16_t height,
+                              subsampling_t subsampling_x, subsampling_t subsampling_y);
+int8_t po8030_set_ae(uint8_t ae);
+int8_t po8030_set_awb(uint8_t awb);
+int8_t po8030_set_exposure(uint16_t integral, uint8_t fractional);
+uint32_t po8030_get_image_size(void);
+
+#endif /* HOST_PO8030_H */
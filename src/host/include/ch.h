@@ -0,0 +1,93 @@
+#ifndef HOST_CH_H
+#define HOST_CH_H
+
+/*
+ *  Subset of the ChibiOS kernel API used by the application, implemented by
+ *  chibios_shim.c with cooperative threads on a discrete-event virtual clock
+ *  (1 tick = 1 ms, as CH_CFG_ST_FREQUENCY in chconf.h).
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint32_t systime_t;
+typedef int32_t msg_t;
+typedef uint32_t rtcnt_t;
+typedef uint8_t tprio_t;
+
+#define TRUE true
+#define FALSE false
+
+#define MSG_OK 0
+#define MSG_TIMEOUT -1
+
+#define TIME_IMMEDIATE ((systime_t)0)
+#define TIME_INFINITE ((systime_t)-1)
+
+#define NORMALPRIO 128
+
+#define CH_CFG_ST_FREQUENCY 1000
+#define MS2ST(msec) ((systime_t)(msec))
+#define S2ST(sec) ((systime_t)((sec) * 1000))
+#define US2ST(usec) ((systime_t)(((usec) + 999) / 1000))
+#define ST2MS(n) ((uint32_t)(n))
+
+// the working areas are not used as stacks on the host, each thread has its own stack
+#define THD_WORKING_AREA(s, n) uint8_t s[n]
+#define THD_FUNCTION(tname, arg) void tname(void *arg)
+typedef void (*tfunc_t)(void *arg);
+
+typedef struct host_thread thread_t;
+
+// Queue of the threads waiting for a semaphore or a mutex
+typedef struct
+{
+    thread_t *head;
+} threads_queue_t;
+
+// Binary semaphore, the threads waiting are woken up in FIFO order
+typedef struct
+{
+    bool taken;
+    threads_queue_t queue;
+} binary_semaphore_t;
+#define BSEMAPHORE_DECL(name, taken) binary_semaphore_t name = {taken, {NULL}}
+
+// Mutex, the threads waiting get it by priority, then in FIFO order
+typedef struct
+{
+    thread_t *owner;
+    threads_queue_t queue;
+} mutex_t;
+#define MUTEX_DECL(name) mutex_t name = {NULL, {NULL}}
+
+void chSysInit(void);
+void chSysLock(void);
+void chSysUnlock(void);
+void chSysHalt(const char *reason);
+rtcnt_t chSysGetRealtimeCounterX(void);
+
+thread_t *chThdCreateStatic(void *wsp, size_t size, tprio_t prio, tfunc_t pf, void *arg);
+void chRegSetThreadName(const char *name);
+void chThdSleep(systime_t time);
+void chThdSleepMilliseconds(uint32_t msec);
+void chThdSleepSeconds(uint32_t sec);
+void chThdSleepUntil(systime_t time);
+systime_t chThdSleepUntilWindowed(systime_t prev, systime_t next);
+void chThdYield(void);
+bool chThdShouldTerminateX(void);
+
+systime_t chVTGetSystemTime(void);
+systime_t chVTGetSystemTimeX(void);
+
+void chBSemObjectInit(binary_semaphore_t *bsp, bool taken);
+msg_t chBSemWait(binary_semaphore_t *bsp);
+msg_t chBSemWaitTimeout(binary_semaphore_t *bsp, systime_t time);
+void chBSemSignal(binary_semaphore_t *bsp);
+
+void chMtxObjectInit(mutex_t *mp);
+void chMtxLock(mutex_t *mp);
+void chMtxUnlock(mutex_t *mp);
+
+#endif /* HOST_CH_H */
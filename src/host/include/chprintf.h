@@ -0,0 +1,8 @@
+#ifndef HOST_CHPRINTF_H
+#define HOST_CHPRINTF_H
+
+#include <hal.h>
+
+int chprintf(BaseSequentialStream *chp, const char *fmt, ...);
+
+#endif /* HOST_CHPRINTF_H */
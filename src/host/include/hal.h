@@ -0,0 +1,63 @@
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+/*
+ *  Subset of the ChibiOS HAL used by the application: the serial drivers only
+ *  print on the standard output of the host.
+ */
+
+#include <ch.h>
+
+// the realtime counter counts the cycles of the STM32F407 at 168 MHz in virtual time
+#define STM32_SYSCLK 168000000
+
+typedef struct
+{
+    void *dummy;
+} BaseSequentialStream;
+
+typedef struct
+{
+    uint32_t speed;
+    uint16_t cr1;
+    uint16_t cr2;
+    uint16_t cr3;
+} SerialConfig;
+
+typedef struct
+{
+    BaseSequentialStream stream;
+} SerialDriver;
+
+typedef enum
+{
+    USB_UNINIT = 0,
+    USB_STOP,
+    USB_READY,
+    USB_SELECTED,
+    USB_ACTIVE,
+} usbstate_t;
+
+typedef struct
+{
+    usbstate_t state;
+} USBDriver;
+
+typedef struct
+{
+    USBDriver *usbp;
+} SerialUSBConfig;
+
+typedef struct
+{
+    BaseSequentialStream stream;
+    const SerialUSBConfig *config;
+} SerialUSBDriver;
+
+extern SerialDriver SD3;
+
+void halInit(void);
+void sdStart(SerialDriver *sdp, const SerialConfig *config);
+size_t chSequentialStreamWrite(BaseSequentialStream *chp, const uint8_t *bp, size_t n);
+
+#endif /* HOST_HAL_H */
@@ -0,0 +1,10 @@
+#ifndef HOST_I2C_BUS_H
+#define HOST_I2C_BUS_H
+
+#include <stdint.h>
+
+void i2c_start(void);
+int8_t read_reg(uint8_t addr, uint8_t reg, uint8_t *value);
+int8_t write_reg(uint8_t addr, uint8_t reg, uint8_t value);
+
+#endif /* HOST_I2C_BUS_H */
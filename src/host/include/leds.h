@@ -0,0 +1,30 @@
+#ifndef HOST_LEDS_H
+#define HOST_LEDS_H
+
+#include <stdint.h>
+
+typedef enum
+{
+    LED1,
+    LED3,
+    LED5,
+    LED7,
+    FRONT_LED,
+    BODY_LED,
+    NUM_LED,
+} led_name_t;
+
+typedef enum
+{
+    LED2,
+    LED4,
+    LED6,
+    LED8,
+    NUM_RGB_LED,
+} rgb_led_name_t;
+
+void clear_leds(void);
+void set_led(led_name_t led_number, unsigned int value);
+void set_rgb_led(rgb_led_name_t led_number, uint8_t red_val, uint8_t green_val, uint8_t blue_val);
+
+#endif /* HOST_LEDS_H */
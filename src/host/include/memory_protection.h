@@ -0,0 +1,6 @@
+#ifndef HOST_MEMORY_PROTECTION_H
+#define HOST_MEMORY_PROTECTION_H
+
+void mpu_init(void);
+
+#endif /* HOST_MEMORY_PROTECTION_H */
@@ -0,0 +1,9 @@
+#ifndef HOST_MESSAGEBUS_H
+#define HOST_MESSAGEBUS_H
+
+typedef struct
+{
+    void *topics;
+} messagebus_t;
+
+#endif /* HOST_MESSAGEBUS_H */
@@ -0,0 +1,9 @@
+#ifndef HOST_PARAMETER_H
+#define HOST_PARAMETER_H
+
+typedef struct
+{
+    const char *id;
+} parameter_namespace_t;
+
+#endif /* HOST_PARAMETER_H */
@@ -0,0 +1,51 @@
+#ifndef HOST_VL53L0X_H
+#define HOST_VL53L0X_H
+
+#include <stdint.h>
+
+#define VL53L0X_ADDR 0x52
+
+typedef int8_t VL53L0X_Error;
+#define VL53L0X_ERROR_NONE ((VL53L0X_Error)0)
+#define VL53L0X_ERROR_CONTROL_INTERFACE ((VL53L0X_Error)-20)
+
+typedef uint8_t VL53L0X_DeviceModes;
+#define VL53L0X_DEVICEMODE_SINGLE_RANGING ((VL53L0X_DeviceModes)0)
+#define VL53L0X_DEVICEMODE_CONTINUOUS_RANGING ((VL53L0X_DeviceModes)1)
+
+typedef enum
+{
+    VL53L0X_DEFAULT_MODE = 0,
+    VL53L0X_HIGH_ACCURACY,
+    VL53L0X_LONG_RANGE,
+    VL53L0X_HIGH_SPEED,
+} VL53L0X_AccuracyMode;
+
+typedef struct
+{
+    uint16_t RangeMilliMeter;
+    uint8_t RangeStatus;
+} VL53L0X_RangingMeasurementData_t;
+
+typedef struct
+{
+    VL53L0X_RangingMeasurementData_t LastRangeMeasure;
+} VL53L0X_DevData_t;
+
+typedef struct
+{
+    VL53L0X_DevData_t Data;
+    uint8_t I2cDevAddr;
+} VL53L0X_Dev_t;
+
+VL53L0X_Error VL53L0X_init(VL53L0X_Dev_t *device);
+VL53L0X_Error VL53L0X_configAccuracy(VL53L0X_Dev_t *device, VL53L0X_AccuracyMode accuracy);
+VL53L0X_Error VL53L0X_startMeasure(VL53L0X_Dev_t *device, VL53L0X_DeviceModes mode);
+VL53L0X_Error VL53L0X_getLastMeasure(VL53L0X_Dev_t *device);
+VL53L0X_Error VL53L0X_stopMeasure(VL53L0X_Dev_t *device);
+// functions of the ST API included by the e-puck2 library
+VL53L0X_Error VL53L0X_GetMeasurementDataReady(VL53L0X_Dev_t *device, uint8_t *pMeasurementDataReady);
+VL53L0X_Error VL53L0X_ClearInterruptMask(VL53L0X_Dev_t *device, uint32_t InterruptMask);
+VL53L0X_Error VL53L0X_GetMeasurementTimingBudgetMicroSeconds(VL53L0X_Dev_t *device, uint32_t *pMeasurementTimingBudgetMicroSeconds);
+
+#endif /* HOST_VL53L0X_H */
@@ -0,0 +1,6 @@
+#ifndef HOST_SPI_COMM_H
+#define HOST_SPI_COMM_H
+
+void spi_comm_start(void);
+
+#endif /* HOST_SPI_COMM_H */
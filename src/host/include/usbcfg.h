@@ -0,0 +1,11 @@
+#ifndef HOST_USBCFG_H
+#define HOST_USBCFG_H
+
+#include <hal.h>
+
+// USB serial link, active when the simulation prints the reports of the robot
+extern SerialUSBDriver SDU1;
+
+void usb_start(void);
+
+#endif /* HOST_USBCFG_H */
@@ -0,0 +1,215 @@
+#include <math.h>
+
+#include "playground.h"
+
+// distance between the wheels (in mm)
+#define WHEEL_DISTANCE 53.0f
+// radius of the robot, it stops against the walls (in mm)
+#define ROBOT_RADIUS 37.0f
+// half width of the red center line and of the blue lines of the strings, and half side of the black squares (in mm)
+#define CENTER_LINE_HALF_WIDTH 6.0f
+#define STRING_LINE_HALF_WIDTH 5.0f
+#define CROSSING_HALF_SIDE 9.0f
+// limits of the paper, distances measured by the TOF from the WALL_2
+#define PAPER_HALF_WIDTH 210.0f
+#define PAPER_NEAR 7.0f
+#define PAPER_FAR 457.0f
+// focal length of the camera (in pixel per radian, 45 deg on the 640 columns)
+#define CAMERA_FOCAL 815.0f
+// angle of the optical axis under the horizon: the line 200 of the sensor sees the ground 65 mm ahead
+#define CAMERA_TILT 0.543f
+// minimum angle of a ray under the horizon to hit the paper, the others see the walls
+#define CAMERA_MIN_ANGLE 0.02f
+
+const float playground_string_distance[NB_STRINGS] = {106, 161, 216, 269, 317, 367};
+
+static const reflectance_t paper = {0.90f, 0.90f, 0.88f};
+static const reflectance_t red_line = {0.80f, 0.15f, 0.15f};
+static const reflectance_t blue_line = {0.15f, 0.25f, 0.80f};
+static const reflectance_t crossing = {0.08f, 0.08f, 0.08f};
+static const reflectance_t table = {0.45f, 0.40f, 0.35f};
+static const reflectance_t wall = {0.60f, 0.60f, 0.60f};
+
+static pose_t robot;
+
+/*
+ *  Converts a distance measured by the TOF from the WALL_2, when facing it, into a y coordinate.
+ */
+static float y_from_wall_2(float distance)
+{
+    return PLAYGROUND_LENGTH - (distance + TOF_OFFSET);
+}
+
+/*
+ *  Places the robot at the start: on the center line, facing the WALL_2.
+ */
+void playground_init(void)
+{
+    robot = (pose_t){.x = CENTER_X, .y = y_from_wall_2(START_DISTANCE), .heading = M_PI / 2};
+}
+
+pose_t playground_get_pose(void)
+{
+    return robot;
+}
+
+void playground_set_pose(pose_t pose)
+{
+    robot = pose;
+}
+
+/*
+ *  Returns the y coordinate of the line of a string: the TOF measures the
+ *  distance of the string from the WALL_2 when the center of the robot is on it.
+ *
+ *  params:
+ *  uint8_t string          String, from 1 to NB_STRINGS.
+ */
+float playground_string_y(uint8_t string)
+{
+    return y_from_wall_2(playground_string_distance[string - 1]);
+}
+
+/*
+ *  Returns the pose of the robot after moving with constant speeds of its
+ *  wheels during dt (differential drive): the robot follows an arc of circle,
+ *  exactly whatever dt. The walls are not taken into account.
+ *
+ *  params:
+ *  pose_t pose             Pose at the start.
+ *  float left_speed        Speed of the left wheel (in mm/s).
+ *  float right_speed       Speed of the right wheel (in mm/s).
+ *  float dt                Duration (in s).
+ */
+pose_t playground_integrate(pose_t pose, float left_speed, float right_speed, float dt)
+{
+    float speed = (left_speed + right_speed) / 2;
+    float rotation = (right_speed - left_speed) / WHEEL_DISTANCE * dt;
+    float heading = pose.heading + rotation;
+
+    if (fabsf(rotation) < 1e-6f)
+    {
+        pose.x += speed * dt * cosf(pose.heading);
+        pose.y += speed * dt * sinf(pose.heading);
+    }
+    else
+    {
+        // radius of the arc: speed / angular speed
+        float radius = speed * dt / rotation;
+        pose.x += radius * (sinf(heading) - sinf(pose.heading));
+        pose.y -= radius * (cosf(heading) - cosf(pose.heading));
+    }
+    pose.heading = remainderf(heading, 2 * M_PI);
+    return pose;
+}
+
+/*
+ *  Moves the robot with constant speeds of its wheels during dt. The robot
+ *  does not go through the walls.
+ *
+ *  params:
+ *  float left_speed        Speed of the left wheel (in mm/s).
+ *  float right_speed       Speed of the right wheel (in mm/s).
+ *  float dt                Duration (in s).
+ */
+void playground_move(float left_speed, float right_speed, float dt)
+{
+    robot = playground_integrate(robot, left_speed, right_speed, dt);
+    robot.x = fminf(fmaxf(robot.x, ROBOT_RADIUS), PLAYGROUND_WIDTH - ROBOT_RADIUS);
+    robot.y = fminf(fmaxf(robot.y, ROBOT_RADIUS), PLAYGROUND_LENGTH - ROBOT_RADIUS);
+}
+
+/*
+ *  Returns the distance from the TOF to the wall in front of the robot, along
+ *  the axis of the robot (in mm).
+ *
+ *  params:
+ *  const pose_t *pose      Pose of the robot.
+ */
+float playground_tof_range(const pose_t *pose)
+{
+    float dx = cosf(pose->heading);
+    float dy = sinf(pose->heading);
+    float x = pose->x + TOF_OFFSET * dx;
+    float y = pose->y + TOF_OFFSET * dy;
+    float range = INFINITY;
+
+    // first wall crossed by the ray, in x and in y
+    if (dx > 1e-6f)
+    {
+        range = fminf(range, (PLAYGROUND_WIDTH - x) / dx);
+    }
+    else if (dx < -1e-6f)
+    {
+        range = fminf(range, -x / dx);
+    }
+    if (dy > 1e-6f)
+    {
+        range = fminf(range, (PLAYGROUND_LENGTH - y) / dy);
+    }
+    else if (dy < -1e-6f)
+    {
+        range = fminf(range, -y / dy);
+    }
+    return fmaxf(range, 0);
+}
+
+/*
+ *  Returns the reflectance of the ground at a point of the playground: the
+ *  paper with the red center line, the blue lines of the strings and the
+ *  black squares where they cross, or the table around the paper.
+ *
+ *  params:
+ *  float x, y              Point of the ground (in mm).
+ */
+reflectance_t playground_ground(float x, float y)
+{
+    float dx = fabsf(x - CENTER_X);
+    if (dx > PAPER_HALF_WIDTH || y < y_from_wall_2(PAPER_FAR) || y > y_from_wall_2(PAPER_NEAR))
+    {
+        return table;
+    }
+
+    for (uint8_t string = 1; string <= NB_STRINGS; string++)
+    {
+        float dy = fabsf(y - playground_string_y(string));
+        if (dx <= CROSSING_HALF_SIDE && dy <= CROSSING_HALF_SIDE)
+        {
+            return crossing;
+        }
+        if (dy <= STRING_LINE_HALF_WIDTH)
+        {
+            return blue_line;
+        }
+    }
+    return (dx <= CENTER_LINE_HALF_WIDTH) ? red_line : paper;
+}
+
+/*
+ *  Returns the reflectance seen by a pixel of the camera: pinhole camera
+ *  looking down at the front of the robot, the rays above the horizon see the walls.
+ *
+ *  params:
+ *  const pose_t *pose      Pose of the robot.
+ *  float column            Column of the sensor, from the left (0 to SENSOR_WIDTH).
+ *  float line              Line of the sensor, from the top (0 to SENSOR_HEIGHT).
+ */
+reflectance_t playground_camera_pixel(const pose_t *pose, float column, float line)
+{
+    // angle of the ray under the horizon, and to the right of the axis
+    float elevation = CAMERA_TILT + (line - SENSOR_HEIGHT / 2) / CAMERA_FOCAL;
+    float azimuth = (column - SENSOR_WIDTH / 2) / CAMERA_FOCAL;
+    if (elevation < CAMERA_MIN_ANGLE)
+    {
+        return wall;
+    }
+
+    float ahead = CAMERA_HEIGHT / tanf(elevation);
+    float right = tanf(azimuth) * CAMERA_HEIGHT / sinf(elevation);
+    float cos_heading = cosf(pose->heading);
+    float sin_heading = sinf(pose->heading);
+    ahead += CAMERA_OFFSET;
+    // the right of the robot is (sin, -cos) of its heading
+    return playground_ground(pose->x + ahead * cos_heading + right * sin_heading,
+                             pose->y + ahead * sin_heading - right * cos_heading);
+}
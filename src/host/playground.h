@@ -0,0 +1,58 @@
+#ifndef PLAYGROUND_H
+#define PLAYGROUND_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ *  Frame of the playground (in mm): x from the WALL_1 (x = 0) to the WALL_3,
+ *  y from the WALL_0 (y = 0) to the WALL_2. The heading of the robot is the
+ *  angle of its front from the x axis, counterclockwise: the robot starts on
+ *  the center line facing the WALL_2 (pi / 2).
+ */
+
+// distance between the center line and the walls 1 and 3, and of each string from the WALL_2, measured by the TOF
+#define CENTER_TO_WALL 229
+#define NB_STRINGS 6
+// distance from the center of the robot to the TOF (front of the robot), to the camera, and height of the camera
+#define TOF_OFFSET 35
+#define CAMERA_OFFSET 30
+#define CAMERA_HEIGHT 35
+// the walls 1 and 3 are placed so the TOF measures CENTER_TO_WALL on the center line
+#define PLAYGROUND_WIDTH (2 * (CENTER_TO_WALL + TOF_OFFSET))
+#define PLAYGROUND_LENGTH 520
+#define CENTER_X (PLAYGROUND_WIDTH / 2)
+// distance measured by the TOF from the WALL_2 at the start
+#define START_DISTANCE 405
+// number of columns and lines of the sensor of the camera
+#define SENSOR_WIDTH 640
+#define SENSOR_HEIGHT 480
+
+typedef struct
+{
+    float x;
+    float y;
+    float heading;
+} pose_t;
+
+// Reflectance of the ground in the red, green and blue channels, from 0 to 1
+typedef struct
+{
+    float r;
+    float g;
+    float b;
+} reflectance_t;
+
+extern const float playground_string_distance[NB_STRINGS];
+
+void playground_init(void);
+pose_t playground_get_pose(void);
+void playground_set_pose(pose_t pose);
+pose_t playground_integrate(pose_t pose, float left_speed, float right_speed, float dt);
+void playground_move(float left_speed, float right_speed, float dt);
+float playground_tof_range(const pose_t *pose);
+float playground_string_y(uint8_t string);
+reflectance_t playground_ground(float x, float y);
+reflectance_t playground_camera_pixel(const pose_t *pose, float column, float line);
+
+#endif /* PLAYGROUND_H */
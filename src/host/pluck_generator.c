@@ -0,0 +1,193 @@
+#include <math.h>
+
+#include <audio/microphone.h>
+
+#include "../pitch_detection.h"
+#include "pluck_generator.h"
+
+/*
+ *  Synthesis of a plucked string heard by the microphones, with known frequency
+ *  and noise, to measure the accuracy of the detection (see sweep_main.c).
+ *  The string is a sum of decaying partials (additive synthesis): the partials
+ *  are slightly sharp (inharmonicity of the stiffness of the string), their
+ *  amplitude depends on the position of the pluck and on the resonances of the
+ *  body of the guitar, and the higher ones decay faster. The noise is the whine
+ *  of the stepper motors (step frequency and harmonics) and the noise of the
+ *  room (white, plus a low-pass filtered part). The 4 microphones hear the same
+ *  signal: only one is used by the detection.
+ */
+
+// processAudioData keeps 1 sample out of AUDIO_DECIMATION
+#define AUDIO_DECIMATION 20
+// sample rate of the microphones, calibrated on the robot as FREQUENCY_PRECISION (in Hz)
+#define SAMPLE_RATE (FREQUENCY_PRECISION * FFT_SIZE * AUDIO_DECIMATION)
+#define MIC_CHANNELS 4
+// amplitude of the fundamental without resonance, as a pluck of the simulator
+#define PLUCK_AMPLITUDE 4000.0f
+// position of the pluck from the bridge (fraction of the length of the string)
+#define PLUCK_POSITION 0.18f
+// the partial n decays with the time constant decay / (1 + PARTIAL_DAMPING * (n - 1))
+#define PARTIAL_DAMPING 0.5f
+// cutoff of the low-pass filtered noise of the room (in Hz)
+#define ROOM_LOW_CUTOFF 150.0f
+// amplitude of the step frequency of the motors, relative to the standard deviation of the white noise
+#define MOTOR_LEVEL 2.0f
+#define NB_BODY_RESONANCES 2
+
+// Resonance of the body of the guitar
+typedef struct
+{
+    float frequency; // in Hz
+    float quality;
+    float gain;      // gain added at the resonance
+} resonance_t;
+
+// air cavity and top plate of an acoustic guitar
+static const resonance_t body[NB_BODY_RESONANCES] = {{100.0f, 8.0f, 1.0f}, {205.0f, 10.0f, 0.6f}};
+static const float motor_harmonics[MOTOR_TONES] = {1.0f, 0.5f, 0.25f};
+
+/*
+ *  Returns a pseudo-random number uniform in [0, 1[ (xorshift).
+ */
+static float random_uniform(pluck_generator_t *generator)
+{
+    generator->random_state ^= generator->random_state << 13;
+    generator->random_state ^= generator->random_state >> 17;
+    generator->random_state ^= generator->random_state << 5;
+    return (generator->random_state >> 8) / (float)(1 << 24);
+}
+
+/*
+ *  Returns a pseudo-random number of variance 1 (triangular distribution,
+ *  cheaper than a normal one for the same spectrum).
+ */
+static float random_white(pluck_generator_t *generator)
+{
+    return (random_uniform(generator) + random_uniform(generator) - 1) * 2.449490f;
+}
+
+/*
+ *  Starts an oscillator: sine of an amplitude, a frequency and a phase, damped
+ *  with a time constant (0 for a constant amplitude).
+ */
+static void oscillator_init(oscillator_t *oscillator, float amplitude, float frequency, float phase, float decay)
+{
+    double damping = (decay > 0) ? exp(-1.0 / (decay * SAMPLE_RATE)) : 1.0;
+    double angle = 2 * M_PI * frequency / SAMPLE_RATE;
+
+    oscillator->real = amplitude * cos(phase);
+    oscillator->imag = amplitude * sin(phase);
+    oscillator->step_real = damping * cos(angle);
+    oscillator->step_imag = damping * sin(angle);
+}
+
+/*
+ *  Returns the sample of an oscillator and rotates it to the next sample.
+ */
+static inline float oscillator_next(oscillator_t *oscillator)
+{
+    double real = oscillator->real;
+    float sample = oscillator->imag;
+
+    oscillator->real = real * oscillator->step_real - oscillator->imag * oscillator->step_imag;
+    oscillator->imag = real * oscillator->step_imag + oscillator->imag * oscillator->step_real;
+    return sample;
+}
+
+/*
+ *  Returns the gain of the body of the guitar at a frequency.
+ */
+static float body_gain(float frequency)
+{
+    float gain = 1;
+    for (uint8_t i = 0; i < NB_BODY_RESONANCES; i++)
+    {
+        float detuning = frequency / body[i].frequency - body[i].frequency / frequency;
+        gain += body[i].gain / sqrtf(1 + body[i].quality * body[i].quality * detuning * detuning);
+    }
+    return gain;
+}
+
+/*
+ *  Prepares the sound of a pluck: the partials of the string with random
+ *  phases, the tones of the motors, and the amplitude of the noise giving the SNR.
+ *
+ *  params:
+ *  pluck_generator_t *generator    Generator to initialize.
+ *  const pluck_config_t *config    String, noise and start of the pluck.
+ */
+void pluck_generator_init(pluck_generator_t *generator, const pluck_config_t *config)
+{
+    float signal_power = 0;
+    // noise without scale: white and low-pass filtered parts of variance 1, and the motors
+    float noise_power = 2;
+
+    generator->random_state = config->seed ? config->seed : 1;
+    generator->onset = config->onset;
+    generator->room_low = 0;
+    // one-pole low-pass filter of the noise of the room, its gain keeps a variance of 1
+    generator->room_pole = expf(-2 * M_PI * ROOM_LOW_CUTOFF / SAMPLE_RATE);
+    generator->room_gain = sqrtf(1 - generator->room_pole * generator->room_pole);
+
+    for (uint8_t i = 0; i < PLUCK_PARTIALS; i++)
+    {
+        uint8_t n = i + 1;
+        float frequency = n * config->frequency * sqrtf(1 + config->inharmonicity * n * n);
+        // spectrum of a string released from a triangle, the partials with a node at the pluck are missing
+        float amplitude = PLUCK_AMPLITUDE * sinf(n * M_PI * PLUCK_POSITION) / (n * n * sinf(M_PI * PLUCK_POSITION));
+        amplitude = (frequency < SAMPLE_RATE / 2) ? amplitude * body_gain(frequency) : 0;
+
+        oscillator_init(&generator->partials[i], amplitude, frequency, 2 * M_PI * random_uniform(generator),
+                        config->decay / (1 + PARTIAL_DAMPING * i));
+        signal_power += amplitude * amplitude / 2;
+    }
+    for (uint8_t i = 0; i < MOTOR_TONES; i++)
+    {
+        float amplitude = (config->motor_speed > 0) ? MOTOR_LEVEL * motor_harmonics[i] : 0;
+        oscillator_init(&generator->motor[i], amplitude, (i + 1) * config->motor_speed, 2 * M_PI * random_uniform(generator), 0);
+        noise_power += amplitude * amplitude / 2;
+    }
+    generator->noise_scale = sqrtf(signal_power / (noise_power * powf(10, config->snr / 10)));
+}
+
+/*
+ *  Fills a block of the driver of the microphones: MIC_BUFFER_LEN samples, the
+ *  same sample for the 4 microphones.
+ *
+ *  params:
+ *  pluck_generator_t *generator    Generator.
+ *  int16_t *block                  Block of MIC_BUFFER_LEN samples to fill.
+ */
+void pluck_generator_block(pluck_generator_t *generator, int16_t *block)
+{
+    for (uint16_t i = 0; i < MIC_BUFFER_LEN; i += MIC_CHANNELS)
+    {
+        float sample = 0;
+        if (generator->onset > 0)
+        {
+            generator->onset--;
+        }
+        else
+        {
+            for (uint8_t p = 0; p < PLUCK_PARTIALS; p++)
+            {
+                sample += oscillator_next(&generator->partials[p]);
+            }
+        }
+
+        float noise = random_white(generator);
+        generator->room_low = generator->room_pole * generator->room_low + generator->room_gain * random_white(generator);
+        noise += generator->room_low;
+        for (uint8_t m = 0; m < MOTOR_TONES; m++)
+        {
+            noise += oscillator_next(&generator->motor[m]);
+        }
+        sample += generator->noise_scale * noise;
+
+        int16_t value = (int16_t)fmaxf(fminf(sample, INT16_MAX), INT16_MIN);
+        for (uint8_t mic = 0; mic < MIC_CHANNELS; mic++)
+        {
+            block[i + mic] = value;
+        }
+    }
+}
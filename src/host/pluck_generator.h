@@ -0,0 +1,46 @@
+#ifndef PLUCK_GENERATOR_H
+#define PLUCK_GENERATOR_H
+
+#include <stdint.h>
+
+// partials of the string synthesized
+#define PLUCK_PARTIALS 8
+// tones of the motors: step frequency and its harmonics
+#define MOTOR_TONES 3
+
+// Plucked string heard by the microphones, with the noise of the motors and of the room
+typedef struct
+{
+    float frequency;     // fundamental of the string (in Hz)
+    float inharmonicity; // the partial n is at n * frequency * sqrt(1 + inharmonicity * n^2)
+    float decay;         // time constant of the fundamental (in s), the higher partials decay faster
+    float snr;           // power of the string when plucked over the power of the noise (in dB)
+    float motor_speed;   // speed of the motors (in step/s), 0 when they are stopped
+    uint32_t onset;      // samples of noise before the pluck
+    uint32_t seed;       // seed of the noise and of the phases
+} pluck_config_t;
+
+// Oscillator: a complex number rotated (and damped) at each sample, its imaginary part is the signal
+typedef struct
+{
+    double real, imag;
+    double step_real, step_imag;
+} oscillator_t;
+
+// State of the generator
+typedef struct
+{
+    oscillator_t partials[PLUCK_PARTIALS];
+    oscillator_t motor[MOTOR_TONES];
+    uint32_t onset;        // samples left before the pluck
+    uint32_t random_state;
+    float room_low;        // low-pass filtered part of the noise of the room
+    float room_pole;       // pole and gain of its filter
+    float room_gain;
+    float noise_scale;     // amplitude of the noise giving the SNR
+} pluck_generator_t;
+
+void pluck_generator_init(pluck_generator_t *generator, const pluck_config_t *config);
+void pluck_generator_block(pluck_generator_t *generator, int16_t *block);
+
+#endif /* PLUCK_GENERATOR_H */
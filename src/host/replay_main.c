@@ -0,0 +1,290 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <ch.h>
+#include <audio/microphone.h>
+
+#include "../audio_processing.h"
+#include "audio_harness.h"
+
+/*
+ *  Replays a recording of the microphones through processAudioData, as the
+ *  driver of the microphones gives it: blocks of MIC_BUFFER_LEN samples, 160
+ *  samples of the 4 microphones interleaved [right, left, back, front]. Every
+ *  window of FFT_SIZE samples is analyzed (see audio_harness.c). For each
+ *  window, the frequency and the string detected and the processing time of
+ *  its blocks are written as CSV lines:
+ *  window,time_s,frequency_hz,string,processing_us
+ *  (time_s is the end of the window in the recording, string 0 when no string
+ *  is detected). A summary is printed on the error output, with the duration
+ *  of each stage of the detection (see AUDIO_STAGE) measured by latency.c.
+ *
+ *  usage: replay [-r] [-c channels] [-f sample_rate] [-o results.csv] recording
+ *  -r              the recording is raw PCM (16 bits little-endian, interleaved) instead of WAV
+ *  -c channels     channels of the raw PCM: 4 (same order as the driver) or 1 (given to every microphone)
+ *  -f sample_rate  sample rate of the raw PCM (in Hz), only used for the times of the windows
+ *  -o results.csv  writes the CSV lines in this file instead of the standard output
+ */
+
+#define MIC_CHANNELS 4
+// samples of each microphone in one block of the driver
+#define BLOCK_FRAMES (MIC_BUFFER_LEN / MIC_CHANNELS)
+// sample rate of the driver of the microphones (in Hz)
+#define DEFAULT_SAMPLE_RATE 16000
+// the times are wrong if the sample rate of the recording is further than this from the driver (in Hz)
+#define SAMPLE_RATE_TOLERANCE 1000
+
+// Recording read, with the format of its samples
+typedef struct
+{
+    FILE *file;
+    uint16_t channels;     // 4 as the driver, or 1 copied to every microphone
+    uint32_t sample_rate;  // in Hz
+} recording_t;
+
+/*
+ *  Returns the monotonic clock of the computer in ns.
+ */
+static uint64_t clock_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+}
+
+/*
+ *  Returns a little-endian integer of "size" bytes read in a buffer.
+ */
+static uint32_t read_le(const uint8_t *buffer, uint8_t size)
+{
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < size; i++)
+    {
+        value |= (uint32_t)buffer[i] << (8 * i);
+    }
+    return value;
+}
+
+/*
+ *  Reads the header of a WAV file up to its samples, and fills the format of
+ *  the recording. Returns false if the file is not a WAV of 16 bits PCM samples
+ *  with 1 or 4 channels.
+ *
+ *  params:
+ *  recording_t *recording  Recording, its file opened at the start.
+ */
+static bool read_wav_header(recording_t *recording)
+{
+    uint8_t header[12];
+    uint8_t chunk[8];
+    bool format_read = false;
+
+    if (fread(header, 1, sizeof(header), recording->file) != sizeof(header) || memcmp(header, "RIFF", 4) != 0 ||
+        memcmp(header + 8, "WAVE", 4) != 0)
+    {
+        return false;
+    }
+    // chunks up to the samples ("data"), the format ("fmt ") is before them
+    while (fread(chunk, 1, sizeof(chunk), recording->file) == sizeof(chunk))
+    {
+        uint32_t size = read_le(chunk + 4, 4);
+        if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16)
+        {
+            uint8_t format[16];
+            if (fread(format, 1, sizeof(format), recording->file) != sizeof(format))
+            {
+                return false;
+            }
+            // PCM (1) or extensible (0xFFFE) with 16 bits samples
+            uint16_t tag = read_le(format, 2);
+            if ((tag != 1 && tag != 0xFFFE) || read_le(format + 14, 2) != 16)
+            {
+                return false;
+            }
+            recording->channels = read_le(format + 2, 2);
+            recording->sample_rate = read_le(format + 4, 4);
+            format_read = true;
+            size -= sizeof(format);
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            return format_read && (recording->channels == 1 || recording->channels == MIC_CHANNELS);
+        }
+        // chunks are padded to an even size
+        if (fseek(recording->file, size + (size & 1), SEEK_CUR) != 0)
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+/*
+ *  Fills a block of the driver with the next samples of the recording,
+ *  returns false at the end of the recording (the last incomplete block is dropped).
+ *
+ *  params:
+ *  recording_t *recording  Recording read.
+ *  int16_t *block          Block of MIC_BUFFER_LEN samples to fill.
+ */
+static bool read_block(recording_t *recording, int16_t *block)
+{
+    uint8_t bytes[2 * MIC_BUFFER_LEN];
+    size_t size = 2 * BLOCK_FRAMES * recording->channels;
+
+    if (fread(bytes, 1, size, recording->file) != size)
+    {
+        return false;
+    }
+    for (uint16_t frame = 0; frame < BLOCK_FRAMES; frame++)
+    {
+        for (uint8_t mic = 0; mic < MIC_CHANNELS; mic++)
+        {
+            uint16_t sample = (recording->channels == MIC_CHANNELS) ? frame * MIC_CHANNELS + mic : frame;
+            block[frame * MIC_CHANNELS + mic] = (int16_t)read_le(&bytes[2 * sample], 2);
+        }
+    }
+    return true;
+}
+
+/*
+ *  Prints the mean and maximum duration of each stage of the detection over
+ *  all the windows, whatever the string detected.
+ */
+static void print_stages(void)
+{
+    static const char *stage_names[NB_AUDIO_STAGES] = {"fill", "fft", "magnitude", "classification", "decision"};
+
+    fprintf(stderr, "stages per window (mean/max us):");
+    for (AUDIO_STAGE stage = 0; stage < NB_AUDIO_STAGES; stage++)
+    {
+        uint64_t sum = 0;
+        uint32_t count = 0, max = 0;
+        for (GUITAR_STRING string = FIRST_STRING; string <= NO_STRING; string++)
+        {
+            latency_report_t report;
+            get_audio_latency(string, stage, &report, NULL);
+            sum += (uint64_t)report.mean * report.count;
+            count += report.count;
+            max = (report.max > max) ? report.max : max;
+        }
+        fprintf(stderr, " %s %u/%u", stage_names[stage], count ? (uint32_t)(sum / count) : 0, max);
+    }
+    fprintf(stderr, "\n");
+}
+
+/*
+ *  Feeds processAudioData with every block of the recording and writes a CSV
+ *  line for each window analyzed. Prints the summary on the error output.
+ *
+ *  params:
+ *  recording_t *recording  Recording, its file at the first sample.
+ *  FILE *output            CSV output.
+ */
+static void replay(recording_t *recording, FILE *output)
+{
+    int16_t block[MIC_BUFFER_LEN];
+    uint32_t blocks = 0;
+    uint32_t windows = 0;
+    uint32_t detections = 0;
+    // processing time of the blocks of the current window, and of all the windows (in ns)
+    uint64_t window_ns = 0, total_ns = 0, max_ns = 0;
+
+    fprintf(output, "window,time_s,frequency_hz,string,processing_us\n");
+    while (read_block(recording, block))
+    {
+        uint64_t start = clock_ns();
+        processAudioData(block, MIC_BUFFER_LEN);
+        window_ns += clock_ns() - start;
+        blocks++;
+
+        if (audio_windows() == windows)
+        {
+            continue;
+        }
+        windows++;
+        GUITAR_STRING string = get_guitar_string();
+        detections += (string != NO_STRING);
+        fprintf(output, "%u,%.3f,%.2f,%d,%.1f\n", windows, (double)blocks * BLOCK_FRAMES / recording->sample_rate,
+                get_frequency(), (string == NO_STRING) ? 0 : string, window_ns / 1000.0);
+        total_ns += window_ns;
+        max_ns = (window_ns > max_ns) ? window_ns : max_ns;
+        window_ns = 0;
+    }
+
+    double duration = (double)blocks * BLOCK_FRAMES / recording->sample_rate;
+    fprintf(stderr, "%u blocks (%.1f s of recording), %u windows, %u with a string\n", blocks, duration, windows,
+            detections);
+    if (windows > 0)
+    {
+        fprintf(stderr, "processing per window: mean %.1f us, max %.1f us, %.0fx real time\n",
+                total_ns / 1000.0 / windows, max_ns / 1000.0, duration / (total_ns / 1e9 > 0 ? total_ns / 1e9 : 1e-9));
+        print_stages();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    recording_t recording = {.channels = MIC_CHANNELS, .sample_rate = DEFAULT_SAMPLE_RATE};
+    const char *output_path = NULL;
+    bool raw = false;
+    int option;
+
+    while ((option = getopt(argc, argv, "rc:f:o:")) != -1)
+    {
+        switch (option)
+        {
+        case 'r':
+            raw = true;
+            break;
+        case 'c':
+            recording.channels = strtoul(optarg, NULL, 0);
+            break;
+        case 'f':
+            recording.sample_rate = strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            output_path = optarg;
+            break;
+        default:
+            optind = argc;
+            break;
+        }
+    }
+    if (optind != argc - 1 || (recording.channels != 1 && recording.channels != MIC_CHANNELS) || recording.sample_rate == 0)
+    {
+        fprintf(stderr, "usage: %s [-r] [-c channels] [-f sample_rate] [-o results.csv] recording\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    recording.file = fopen(argv[optind], "rb");
+    if (recording.file == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", argv[optind]);
+        return EXIT_FAILURE;
+    }
+    if (!raw && !read_wav_header(&recording))
+    {
+        fprintf(stderr, "%s is not a WAV of 16 bits PCM samples with 1 or %d channels\n", argv[optind], MIC_CHANNELS);
+        return EXIT_FAILURE;
+    }
+    if (abs((int32_t)recording.sample_rate - DEFAULT_SAMPLE_RATE) > SAMPLE_RATE_TOLERANCE)
+    {
+        fprintf(stderr, "warning: sample rate of %u Hz, the microphones of the robot sample at %d Hz\n",
+                recording.sample_rate, DEFAULT_SAMPLE_RATE);
+    }
+
+    FILE *output = (output_path != NULL) ? fopen(output_path, "w") : stdout;
+    if (output == NULL)
+    {
+        fprintf(stderr, "cannot write %s\n", output_path);
+        return EXIT_FAILURE;
+    }
+    replay(&recording, output);
+    fclose(recording.file);
+    return (fclose(output) == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,323 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <ch.h>
+
+#include "../main.h"
+#include "../audio_processing.h"
+#include "../image_processing.h"
+#include "../motion.h"
+#include "chibios_shim.h"
+#include "playground.h"
+#include "drivers.h"
+
+/*
+ *  Simulation of a tuning session: the guitarist plucks the strings of a
+ *  scenario one after the other, each time the robot waits for a frequency,
+ *  and the firmware runs unchanged on the simulated playground. For each pluck,
+ *  the time taken by the robot and the distance between its final position and
+ *  the position given by the frequency are reported. The scenario can be
+ *  repeated to simulate hours of operation. The hash of the trace of the
+ *  threads is printed: the same options always give the same trace.
+ *
+ *  The settings of the firmware given at build time (see main.c) can be
+ *  changed by options, which are applied once the firmware started.
+ *
+ *  usage: simulator [-v] [-s seed] [-l illumination] [-r repeat] [-t timeout] [-e max_error] [-c capture_mode]
+ *                   [-o] [-x] [-f] [string:frequency ...]
+ *  -v              prints the changes of state and the reports of the firmware over USB
+ *  -s seed         seed of the noise of the sensors
+ *  -l illumination light on the playground, relative to the nominal light
+ *  -r repeat       number of times the scenario is played
+ *  -t timeout      maximum time for one pluck (in s of simulated time)
+ *  -e max_error    maximum distance to the goal position for a pluck to succeed (in mm)
+ *  -c capture_mode capture mode of the camera, 0 to 4 (see capture_mode_t)
+ *  -o              Otsu threshold for the line detection (THRESHOLD_OTSU) instead of the mean
+ *  -x              automatic exposure of the camera instead of the control of the exposure by the firmware
+ *  -f              fixed ranging mode of the TOF (long range) instead of its change with the distance to the goal
+ */
+
+#define MAX_PLUCKS 32
+#define DEFAULT_TIMEOUT 60
+#define DEFAULT_MAX_ERROR 10
+// time between two plucks while the robot waits for a frequency (in ms)
+#define PLUCK_PERIOD 3000
+// period of the observation of the state of the FSM, as the control period of the motion (in ms)
+#define OBSERVATION_PERIOD 10
+
+// Pluck of a string of the scenario, and its results over the repetitions
+typedef struct
+{
+    uint8_t string;
+    float frequency;
+    uint16_t runs;              // number of times the robot reached the position of the pluck
+    uint32_t detection_ms;      // total time from the first pluck to the detection of the string
+    uint32_t motion_ms;         // total time from the detection to the end of the motion
+    uint32_t max_motion_ms;
+    float error;                // total distance from the position given by the frequency (in mm)
+    float max_error;
+    float max_lateral_error;    // largest distance from the center of the robot to the line of the string (in mm)
+} pluck_t;
+
+// millimetres per hertz of difference with the frequency of each string, as motion.c
+static const uint8_t string_coeff[NB_STRINGS] = {7, 12, 15, 19, 25, 30};
+static const char *state_names[] = {"FREQUENCY_DETECTION", "STRING_POSITION", "ROTATION",
+                                    "FREQUENCY_POSITION", "STRING_CENTER", "DO_NOTHING"};
+static const pluck_t default_plucks[] = {
+    {.string = 6, .frequency = 80.5f},
+    {.string = 6, .frequency = 82.2f},
+    {.string = 4, .frequency = 150.0f},
+    {.string = 4, .frequency = 146.5f},
+    {.string = 1, .frequency = 333.0f},
+};
+
+static pluck_t plucks[MAX_PLUCKS];
+static uint8_t nb_plucks = 0;
+static uint32_t repeat = 1;
+static bool verbose = false;
+static uint32_t timeout_ms = DEFAULT_TIMEOUT * 1000;
+// pluck which did not end, NULL if all ended
+static pluck_t *failed_pluck = NULL;
+// settings of the firmware changed by the options, -1 to keep the setting of the build
+static int capture_mode = -1;
+static int threshold_mode = -1;
+static int auto_exposure = -1;
+static int ranging_schedule = -1;
+
+int firmware_main(void);
+
+static THD_WORKING_AREA(waFirmware, 256);
+static THD_FUNCTION(Firmware, arg)
+{
+    chRegSetThreadName("main");
+    (void)arg;
+
+    firmware_main();
+}
+
+/*
+ *  Waits until the state of the FSM is different from "state", or the time
+ *  limit, and returns the new state. The changes of state are printed in verbose mode.
+ */
+static FSM_STATE wait_state_change(FSM_STATE state, systime_t limit)
+{
+    while (get_FSM_state() == state && chVTGetSystemTime() < limit)
+    {
+        chThdSleepMilliseconds(OBSERVATION_PERIOD);
+    }
+    FSM_STATE new_state = get_FSM_state();
+    if (verbose && new_state != state)
+    {
+        printf("%8u ms: %s\r\n", (unsigned)chVTGetSystemTime(), state_names[new_state]);
+    }
+    return new_state;
+}
+
+/*
+ *  Plays one pluck of the scenario: plucks the string while the robot waits for
+ *  a frequency, then waits for the end of the motion. Returns false if the robot
+ *  did not come back to the detection of a frequency in time.
+ */
+static bool play_pluck(pluck_t *pluck)
+{
+    systime_t start = chVTGetSystemTime();
+    systime_t limit = start + MS2ST(timeout_ms);
+    FSM_STATE state = get_FSM_state();
+
+    while (state == FREQUENCY_DETECTION && chVTGetSystemTime() < limit)
+    {
+        drivers_pluck(pluck->frequency);
+        state = wait_state_change(state, chVTGetSystemTime() + MS2ST(PLUCK_PERIOD));
+    }
+    drivers_mute();
+    systime_t detection = chVTGetSystemTime();
+
+    while (state != FREQUENCY_DETECTION && state != DO_NOTHING && chVTGetSystemTime() < limit)
+    {
+        state = wait_state_change(state, limit);
+    }
+    if (state != FREQUENCY_DETECTION)
+    {
+        return false;
+    }
+
+    // the goal is computed like the firmware, from the frequency it detected
+    pose_t pose = playground_get_pose();
+    GUITAR_STRING string = get_guitar_string();
+    float goal = CENTER_TO_WALL + (get_frequency() - get_string_frequency()) * string_coeff[string - 1];
+    float error = fabsf(pose.x - TOF_OFFSET - goal);
+    uint32_t motion_ms = ST2MS(chVTGetSystemTime() - detection);
+
+    pluck->runs++;
+    pluck->detection_ms += ST2MS(detection - start);
+    pluck->motion_ms += motion_ms;
+    pluck->max_motion_ms = (motion_ms > pluck->max_motion_ms) ? motion_ms : pluck->max_motion_ms;
+    pluck->error += error;
+    pluck->max_error = fmaxf(pluck->max_error, error);
+    pluck->max_lateral_error = fmaxf(pluck->max_lateral_error, fabsf(pose.y - playground_string_y(string)));
+    return true;
+}
+
+static THD_WORKING_AREA(waScenario, 256);
+static THD_FUNCTION(Scenario, arg)
+{
+    chRegSetThreadName(__FUNCTION__);
+    (void)arg;
+
+    // lets the firmware start
+    chThdSleepMilliseconds(100);
+    if (capture_mode >= 0)
+    {
+        select_capture_mode(capture_mode);
+    }
+    if (threshold_mode >= 0)
+    {
+        select_threshold_mode(threshold_mode);
+    }
+    if (auto_exposure >= 0)
+    {
+        select_auto_exposure(auto_exposure);
+    }
+    if (ranging_schedule >= 0)
+    {
+        select_ranging_schedule(ranging_schedule);
+    }
+    for (uint32_t run = 0; run < repeat && failed_pluck == NULL; run++)
+    {
+        for (uint8_t i = 0; i < nb_plucks; i++)
+        {
+            if (verbose)
+            {
+                printf("%8u ms: pluck of the string %d at %.2f Hz\r\n", (unsigned)chVTGetSystemTime(),
+                       plucks[i].string, plucks[i].frequency);
+            }
+            if (!play_pluck(&plucks[i]))
+            {
+                failed_pluck = &plucks[i];
+                break;
+            }
+        }
+    }
+    host_stop();
+    chThdSleepSeconds(1);
+}
+
+/*
+ *  Prints the results of each pluck of the scenario and the speed of the
+ *  simulation, and returns true if every pluck ended at less than max_error from its goal.
+ */
+static bool print_results(float max_error, double host_seconds)
+{
+    bool success = (failed_pluck == NULL);
+
+    printf("pluck string frequency runs detection_ms motion_ms max_motion_ms error_mm max_error_mm max_lateral_mm\n");
+    for (uint8_t i = 0; i < nb_plucks; i++)
+    {
+        pluck_t *pluck = &plucks[i];
+        uint16_t runs = pluck->runs ? pluck->runs : 1;
+        success &= (pluck->max_error <= max_error);
+        printf("%5d %6d %9.2f %4u %12u %9u %13u %8.1f %12.1f %14.1f%s\n", i + 1, pluck->string, pluck->frequency,
+               pluck->runs, (unsigned)(pluck->detection_ms / runs), (unsigned)(pluck->motion_ms / runs),
+               (unsigned)pluck->max_motion_ms, pluck->error / runs, pluck->max_error, pluck->max_lateral_error,
+               (pluck == failed_pluck) ? "  timeout or stopped" : "");
+    }
+    double simulated_seconds = ST2MS(chVTGetSystemTime()) / 1000.0;
+    printf("simulated %.1f s in %.2f s (%.0fx real time), %u context switches, trace %016llx: %s\n",
+           simulated_seconds, host_seconds, simulated_seconds / (host_seconds > 0 ? host_seconds : 1e-9),
+           (unsigned)host_context_switches(), (unsigned long long)host_trace_hash(), success ? "success" : "FAILURE");
+    return success;
+}
+
+/*
+ *  Adds a pluck "string:frequency" to the scenario.
+ */
+static bool parse_pluck(const char *text)
+{
+    unsigned string;
+    float frequency;
+    if (nb_plucks == MAX_PLUCKS || sscanf(text, "%u:%f", &string, &frequency) != 2 || string < 1 || string > NB_STRINGS)
+    {
+        return false;
+    }
+    plucks[nb_plucks++] = (pluck_t){.string = string, .frequency = frequency};
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    float max_error = DEFAULT_MAX_ERROR;
+    int option;
+
+    while ((option = getopt(argc, argv, "vs:l:r:t:e:c:oxf")) != -1)
+    {
+        switch (option)
+        {
+        case 'v':
+            verbose = true;
+            break;
+        case 's':
+            drivers_set_seed(strtoul(optarg, NULL, 0));
+            break;
+        case 'l':
+            drivers_set_illumination(strtof(optarg, NULL));
+            break;
+        case 'r':
+            repeat = strtoul(optarg, NULL, 0);
+            break;
+        case 't':
+            timeout_ms = strtoul(optarg, NULL, 0) * 1000;
+            break;
+        case 'e':
+            max_error = strtof(optarg, NULL);
+            break;
+        case 'o':
+            threshold_mode = THRESHOLD_OTSU;
+            break;
+        case 'x':
+            auto_exposure = false;
+            break;
+        case 'f':
+            ranging_schedule = false;
+            break;
+        case 'c':
+            capture_mode = strtol(optarg, NULL, 0);
+            if (capture_mode >= 0 && capture_mode < NB_CAPTURE_MODES)
+            {
+                break;
+            }
+            // fall through
+        default:
+            fprintf(stderr, "usage: %s [-v] [-s seed] [-l illumination] [-r repeat] [-t timeout] [-e max_error] "
+                            "[-c capture_mode] [-o] [-x] [-f] [string:frequency ...]\n",
+                    argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    for (int i = optind; i < argc; i++)
+    {
+        if (!parse_pluck(argv[i]))
+        {
+            fprintf(stderr, "invalid pluck \"%s\", expected string:frequency\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (nb_plucks == 0)
+    {
+        nb_plucks = sizeof(default_plucks) / sizeof(default_plucks[0]);
+        memcpy(plucks, default_plucks, sizeof(default_plucks));
+    }
+
+    playground_init();
+    drivers_set_usb(verbose);
+    host_set_clock_hook(drivers_advance);
+    chThdCreateStatic(waFirmware, sizeof(waFirmware), NORMALPRIO, Firmware, NULL);
+    chThdCreateStatic(waScenario, sizeof(waScenario), NORMALPRIO, Scenario, NULL);
+
+    clock_t start = clock();
+    host_run();
+    return print_results(max_error, (double)(clock() - start) / CLOCKS_PER_SEC) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
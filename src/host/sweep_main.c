@@ -0,0 +1,235 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <ch.h>
+#include <audio/microphone.h>
+
+#include "../audio_processing.h"
+#include "audio_harness.h"
+#include "pluck_generator.h"
+
+/*
+ *  Measures the accuracy of the pitch detection on synthetic plucks (see
+ *  pluck_generator.c): every string, detuned by each of "detunings", is plucked
+ *  "cases" times at each SNR, at a random time of a window, and the blocks of
+ *  the microphones are given to processAudioData until a string is detected or
+ *  max_windows windows are analyzed. For each SNR are reported the rate of
+ *  detection of the right string, the rate of wrong strings, the error of the
+ *  frequency detected (in cents) and the number of windows from the pluck to
+ *  the detection. The same options always give the same results.
+ *
+ *  usage: sweep [-v] [-n cases] [-s seed] [-w max_windows] [-m motor_speed] [snr ...]
+ *  -v              prints the results of each string at each SNR
+ *  -n cases        number of plucks of each string at each detuning and SNR
+ *  -s seed         seed of the noise, of the phases and of the times of the plucks
+ *  -w max_windows  windows analyzed after the pluck before giving up
+ *  -m motor_speed  speed of the motors (in step/s) whose whine is added to the noise, 0 for none
+ *  snr             SNR of the plucks (in dB), default list otherwise (after "--" if one is negative)
+ */
+
+#define DEFAULT_CASES 20
+#define DEFAULT_MAX_WINDOWS 4
+#define DEFAULT_MOTOR_SPEED 600.0f
+#define MAX_SNR 16
+#define NB_STRINGS 6
+// blocks of the driver in one window of processAudioData (FFT_SIZE samples, 1 out of 20)
+#define WINDOW_BLOCKS (FFT_SIZE * 20 / (MIC_BUFFER_LEN / 4))
+
+static const float default_snr[] = {40, 30, 20, 10, 5, 0, -5, -10};
+// detunings of the strings (in cents), inside the range of frequencies of each string
+static const float detunings[] = {-90, -50, -20, 0, 20, 50, 90};
+// inharmonicity and decay (in s) of the strings, of the order of magnitude of steel strings
+static const float string_inharmonicity[NB_STRINGS] = {1.0e-4f, 8.0e-5f, 6.0e-5f, 5.0e-5f, 5.0e-5f, 4.0e-5f};
+static const float string_decay[NB_STRINGS] = {2.5f, 2.8f, 3.0f, 3.3f, 3.6f, 4.0f};
+
+// Results of the plucks of one string, or of all, at one SNR
+typedef struct
+{
+    uint32_t cases;
+    uint32_t detected;       // right string detected
+    uint32_t wrong;          // other string detected
+    double cents;            // sum of the absolute errors of the detections (in cents)
+    float max_cents;
+    uint32_t windows;        // sum of the windows from the pluck to the detection
+} results_t;
+
+static uint32_t random_state = 1;
+
+/*
+ *  Returns a pseudo-random integer (xorshift), deterministic for a given seed.
+ */
+static uint32_t random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+/*
+ *  Plucks a string and gives the blocks to processAudioData, from the start of
+ *  a window, until a string is detected or max_windows windows are analyzed.
+ *  The pluck starts at a random time of the first window. Updates the results.
+ *
+ *  params:
+ *  GUITAR_STRING string    String plucked.
+ *  pluck_config_t *config  Sound of the pluck, its onset and seed are drawn here.
+ *  uint8_t max_windows     Windows analyzed before giving up.
+ *  results_t *results      Results to update.
+ *  uint32_t *windows       Total number of windows analyzed, updated.
+ */
+static void play_case(GUITAR_STRING string, pluck_config_t *config, uint8_t max_windows, results_t *results,
+                      uint32_t *windows)
+{
+    pluck_generator_t generator;
+    int16_t block[MIC_BUFFER_LEN];
+
+    config->onset = (random_next() % WINDOW_BLOCKS) * (MIC_BUFFER_LEN / 4);
+    config->seed = random_next();
+    pluck_generator_init(&generator, config);
+    results->cases++;
+
+    for (uint8_t window = 1; window <= max_windows; window++)
+    {
+        // the window ends at the block which makes the detector analyze it
+        uint32_t analyzed = audio_windows();
+        while (audio_windows() == analyzed)
+        {
+            pluck_generator_block(&generator, block);
+            processAudioData(block, MIC_BUFFER_LEN);
+        }
+        (*windows)++;
+
+        GUITAR_STRING detected = get_guitar_string();
+        if (detected == string)
+        {
+            float cents = fabsf(1200 * log2f(get_frequency() / config->frequency));
+            results->detected++;
+            results->cents += cents;
+            results->max_cents = fmaxf(results->max_cents, cents);
+            results->windows += window;
+            return;
+        }
+        else if (detected != NO_STRING)
+        {
+            // the robot would go to the wrong string
+            results->wrong++;
+            return;
+        }
+    }
+}
+
+/*
+ *  Adds the results of a string to the results of all the strings.
+ */
+static void add_results(results_t *total, const results_t *results)
+{
+    total->cases += results->cases;
+    total->detected += results->detected;
+    total->wrong += results->wrong;
+    total->cents += results->cents;
+    total->max_cents = fmaxf(total->max_cents, results->max_cents);
+    total->windows += results->windows;
+}
+
+/*
+ *  Prints a line of results: detection rate, wrong string rate, mean and
+ *  maximum error of the frequency and mean number of windows to the detection.
+ */
+static void print_results(const char *label, float snr, const results_t *results)
+{
+    uint32_t detected = results->detected ? results->detected : 1;
+    printf("%6.1f %6s %6u %9.1f%% %7.1f%% %10.1f %9.1f %17.2f\n", snr, label, results->cases,
+           100.0 * results->detected / results->cases, 100.0 * results->wrong / results->cases,
+           results->cents / detected, results->max_cents, (double)results->windows / detected);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t cases = DEFAULT_CASES;
+    uint8_t max_windows = DEFAULT_MAX_WINDOWS;
+    float motor_speed = DEFAULT_MOTOR_SPEED;
+    bool verbose = false;
+    float snr[MAX_SNR];
+    uint8_t nb_snr = 0;
+    int option;
+
+    while ((option = getopt(argc, argv, "vn:s:w:m:")) != -1)
+    {
+        switch (option)
+        {
+        case 'v':
+            verbose = true;
+            break;
+        case 'n':
+            cases = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            random_state = strtoul(optarg, NULL, 0);
+            random_state = random_state ? random_state : 1;
+            break;
+        case 'w':
+            max_windows = strtoul(optarg, NULL, 0);
+            break;
+        case 'm':
+            motor_speed = strtof(optarg, NULL);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-v] [-n cases] [-s seed] [-w max_windows] [-m motor_speed] [snr ...]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    for (int i = optind; i < argc && nb_snr < MAX_SNR; i++)
+    {
+        snr[nb_snr++] = strtof(argv[i], NULL);
+    }
+    if (nb_snr == 0)
+    {
+        nb_snr = sizeof(default_snr) / sizeof(default_snr[0]);
+        memcpy(snr, default_snr, sizeof(default_snr));
+    }
+
+    uint32_t windows = 0;
+    clock_t start = clock();
+    printf("snr_db string  cases  detected   wrong  cents_mean cents_max windows_to_detect\n");
+    for (uint8_t s = 0; s < nb_snr; s++)
+    {
+        results_t total = {0};
+        for (GUITAR_STRING string = FIRST_STRING; string <= SIXTH_STRING; string++)
+        {
+            results_t results = {0};
+            pluck_config_t config = {.inharmonicity = string_inharmonicity[string - 1],
+                                     .decay = string_decay[string - 1],
+                                     .snr = snr[s],
+                                     .motor_speed = motor_speed};
+
+            for (uint8_t d = 0; d < sizeof(detunings) / sizeof(detunings[0]); d++)
+            {
+                config.frequency = guitar_string_frequency(string) * powf(2, detunings[d] / 1200);
+                for (uint32_t i = 0; i < cases; i++)
+                {
+                    play_case(string, &config, max_windows, &results, &windows);
+                }
+            }
+            if (verbose)
+            {
+                char label[8];
+                snprintf(label, sizeof(label), "%d", string);
+                print_results(label, snr[s], &results);
+            }
+            add_results(&total, &results);
+        }
+        print_results("all", snr[s], &total);
+    }
+
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    uint32_t total_cases = nb_snr * NB_STRINGS * cases * sizeof(detunings) / sizeof(detunings[0]);
+    printf("%u cases, %u windows in %.2f s (%.0f cases/s)\n", total_cases, windows, seconds,
+           total_cases / (seconds > 0 ? seconds : 1e-9));
+    return EXIT_SUCCESS;
+}
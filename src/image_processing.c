@@ -1,34 +1,177 @@
 #include <ch.h>
 #include <hal.h>
+#include <stdlib.h>
+#include <math.h>
 #include <usbcfg.h>
 #include <camera/po8030.h>
+#include <i2c_bus.h>
 
 #include "main.h"
 #include "image_processing.h"
+#include "line_detection.h"
+#ifdef CAPTURE
+#include <string.h>
+#include "frame_capture.h"
+#endif
 
 // Specify the 2 consecutive lines used for tracking the line
 #define USED_LINE 200 // Must be inside [0..478], according to the above explanations
-// width of the slope of pixel intensity (in pixel)
-#define WIDTH_SLOPE 5
-// minimum width of the line detected (in pixel)
-#define MIN_LINE_WIDTH 80
+// number of consecutive lines captured from USED_LINE
+#define CAPTURED_LINES 2
 
-// position of the line detected (center, left, right ...)
+// COMBINED_LINES (see line_detection.h) must be inside [1..CAPTURED_LINES]
+#if COMBINED_LINES < 1 || COMBINED_LINES > CAPTURED_LINES
+#error "COMBINED_LINES must be inside [1..CAPTURED_LINES]"
+#endif
+#if defined(CAPTURE) && FRAME_CAPTURE_LINES != CAPTURED_LINES
+#error "FRAME_CAPTURE_LINES must be CAPTURED_LINES"
+#endif
+
+// distance between the lines processed in the look-ahead mode (in lines of the sensor, multiple of 4)
+#define LOOKAHEAD_STEP 40
+// lines of the sensor captured in the look-ahead mode: from 2 * LOOKAHEAD_STEP before USED_LINE
+// to USED_LINE included, plus the lines combined (subsampled by 4)
+#define LOOKAHEAD_NB_LINES (2 * LOOKAHEAD_STEP + 4 * COMBINED_LINES)
+// number of lines processed in the look-ahead mode: far, middle and USED_LINE
+#define LOOKAHEAD_ROWS 3
+// offset in the look-ahead image (RGB565, 2 bytes per pixel) of the lines combined for USED_LINE,
+// and between the lines processed
+#define LOOKAHEAD_ROW_OFFSET ((LOOKAHEAD_STEP / 4) * 2 * (IMAGE_BUFFER_SIZE / 4))
+#define LOOKAHEAD_NEAR_OFFSET (2 * LOOKAHEAD_ROW_OFFSET)
+
+// weight of the threshold of a new frame in the threshold carried from frame to frame (1/THRESHOLD_FILTER)
+#define THRESHOLD_FILTER 4
+// minimum ratio of the variance between the two classes of pixels to the total variance,
+// under which the image has no line (one class) and the previous threshold is kept
+#define OTSU_MIN_SEPARATION 0.5f
+// intensity of the paper (pixels brighter than the threshold) aimed by the exposure control, and tolerance
+#define EXPOSURE_TARGET 160
+#define EXPOSURE_TOLERANCE 24
+// intensity of the saturated pixels, and maximum fraction of saturated paper (1/EXPOSURE_MAX_SATURATED)
+#define EXPOSURE_SATURATED 0xF8
+#define EXPOSURE_MAX_SATURATED 8
+// maximum variation of the exposure in one correction
+#define EXPOSURE_MAX_STEP 1.5f
+// exposure time limits, and initial exposure time if the one of the sensor cannot be read (in lines of the sensor)
+#define EXPOSURE_MIN 16
+#define EXPOSURE_MAX 1024
+#define EXPOSURE_INITIAL 256
+// minimum time between two corrections, so the sensor applies one before the next (in [ms])
+#define EXPOSURE_PERIOD 200
+// weight of a new measure in the filtered frame period and processing time (1/FRAME_PERIOD_FILTER)
+#define FRAME_PERIOD_FILTER 8
+// number of cycles of the realtime counter in one microsecond
+#define CYCLES_PER_US (STM32_SYSCLK / 1000000)
+
+// Configuration of the camera for each capture mode
+typedef struct
+{
+    format_t format;
+    subsampling_t subsampling;   // horizontal subsampling (register value of the camera)
+    uint8_t factor;              // horizontal subsampling factor: 1, 2 or 4
+    subsampling_t subsampling_y; // vertical subsampling
+    uint16_t first_line;         // first line of the window captured
+    uint16_t nb_lines;           // number of lines of the window captured, before subsampling
+    bool classify;               // the pixels are classified by color instead of using one channel
+    bool lookahead;              // the lines LOOKAHEAD_STEP and 2 * LOOKAHEAD_STEP before USED_LINE are processed too
+} capture_config_t;
+
+static const capture_config_t capture_configs[NB_CAPTURE_MODES] = {
+    [CAPTURE_RGB565] = {.format = FORMAT_RGB565, .subsampling = SUBSAMPLING_X1, .factor = 1, .subsampling_y = SUBSAMPLING_X1,
+                        .first_line = USED_LINE, .nb_lines = CAPTURED_LINES},
+    [CAPTURE_GREYSCALE] = {.format = FORMAT_YYYY, .subsampling = SUBSAMPLING_X1, .factor = 1, .subsampling_y = SUBSAMPLING_X1,
+                           .first_line = USED_LINE, .nb_lines = CAPTURED_LINES},
+    [CAPTURE_GREYSCALE_X2] = {.format = FORMAT_YYYY, .subsampling = SUBSAMPLING_X2, .factor = 2, .subsampling_y = SUBSAMPLING_X1,
+                              .first_line = USED_LINE, .nb_lines = CAPTURED_LINES},
+    [CAPTURE_RGB565_CLASSIFIED] = {.format = FORMAT_RGB565, .subsampling = SUBSAMPLING_X1, .factor = 1, .subsampling_y = SUBSAMPLING_X1,
+                                   .first_line = USED_LINE, .nb_lines = CAPTURED_LINES, .classify = true},
+    [CAPTURE_LOOKAHEAD] = {.format = FORMAT_RGB565, .subsampling = SUBSAMPLING_X4, .factor = 4, .subsampling_y = SUBSAMPLING_X4,
+                           .first_line = USED_LINE - 2 * LOOKAHEAD_STEP, .nb_lines = LOOKAHEAD_NB_LINES, .lookahead = true},
+};
+
+// position of the line detected (center, left, right ...), only used by the thread ProcessImage
 static uint16_t line_position = IMAGE_BUFFER_SIZE / 2; // center by default
 static bool line_found = false;
+// line tracked from frame to frame by the thread ProcessImage, with its sub-pixel position, width and contrast
+static line_track_t track = {.line.position = (IMAGE_BUFFER_SIZE / 2) << LINE_POSITION_SHIFT, .reset = true};
+// restart of the tracking from the next frame asked by the other threads (new color or camera restarted)
+static bool track_reset_request = false;
+// line of the last frame processed, copied as a whole for the other threads (see get_line_measure)
+static line_measure_t line_measure = {.position = (IMAGE_BUFFER_SIZE / 2) << LINE_POSITION_SHIFT};
+// dark segments wide enough to be a line, found in the last image processed
+static line_candidate_t line_candidates[MAX_LINE_CANDIDATES];
+static uint8_t nb_line_candidates = 0;
+
+// line seen ahead of USED_LINE in the look-ahead mode
+static lookahead_t lookahead = {.valid = false};
+
+// histogram of the intensities of the last image processed
+static uint16_t histogram[HISTOGRAM_SIZE];
+// method used to choose the intensity threshold, and threshold of the previous frame
+static threshold_mode_t threshold_mode = THRESHOLD_MEAN;
+static float otsu_threshold = 0;
+// exposure time controlled from the intensity of the paper (in lines of the sensor), 0 before the first correction
+static bool auto_exposure = true;
+static float exposure = 0;
+static systime_t exposure_time = 0;
 
 // Extracts only the pixels of the color specified.
 static color_detection_t detect_color = RED_COLOR;
 
 // semaphore to indicate when an image is ready
 static BSEMAPHORE_DECL(image_ready_sem, TRUE);
+// protects the image buffers of the dcmi, which are reallocated when the capture mode changes
+static MUTEX_DECL(image_buffer_mtx);
+
+// capture mode asked and capture mode of the last frame
+static capture_mode_t capture_mode = CAPTURE_RGB565;
+static capture_mode_t frame_mode = CAPTURE_RGB565;
+// measures of each capture mode to compare them
+static capture_benchmark_t capture_benchmarks[NB_CAPTURE_MODES];
+
+// time and realtime counter of the capture of the last frame
+static systime_t frame_timestamp = 0;
+static rtcnt_t frame_cycles = 0;
+// number of stops of the stream, and value when the last frame was captured: the line of
+// a frame captured before the stream stopped is not published
+static uint32_t stream_stops = 0;
+static uint32_t frame_stream = 0;
+// latency of each stage of the line following, each stage is recorded by a single thread
+static uint32_t pipeline_buckets[NB_PIPELINE_STAGES][LATENCY_BUCKETS];
+static latency_stats_t pipeline_latency[NB_PIPELINE_STAGES] = {
+    [STAGE_EXTRACTION].buckets = pipeline_buckets[STAGE_EXTRACTION],
+    [STAGE_DETECTION].buckets = pipeline_buckets[STAGE_DETECTION],
+    [STAGE_COMMAND].buckets = pipeline_buckets[STAGE_COMMAND],
+};
+
+#ifdef CAPTURE
+// last frame copied for the SendFrame thread, free once sent and ready once copied
+static frame_capture_header_t capture_header;
+static uint8_t capture_pixels[FRAME_CAPTURE_PIXELS_SIZE];
+static BSEMAPHORE_DECL(capture_free_sem, FALSE);
+static BSEMAPHORE_DECL(capture_ready_sem, TRUE);
+#endif
 
 /*
- *  Returns true if a line is found, otherwise false.
+ *  Returns true if a line is tracked (found in the last frames), otherwise false.
  */
 bool get_line_detection(void)
 {
-    return line_found;
+    return line_measure.found;
+}
+
+/*
+ *  Copies the line detected in the last frame processed. Unlike the getters
+ *  below, all its measures come from the same frame.
+ *
+ *  params:
+ *  line_measure_t *measure     Line to fill.
+ */
+void get_line_measure(line_measure_t *measure)
+{
+    chSysLock();
+    *measure = line_measure;
+    chSysUnlock();
 }
 
 /*
@@ -36,7 +179,52 @@ bool get_line_detection(void)
  */
 uint16_t get_line_position(void)
 {
-    return line_position;
+    // rounded to the nearest pixel
+    return (line_measure.position + (1 << (LINE_POSITION_SHIFT - 1))) >> LINE_POSITION_SHIFT;
+}
+
+/*
+ *  Returns the position of the line detected in fixed point, with
+ *  LINE_POSITION_SHIFT fractional bits (sub-pixel precision).
+ */
+uint16_t get_line_position_fine(void)
+{
+    return line_measure.position;
+}
+
+/*
+ *  Returns the identifier of the line tracked, which changes each time a new
+ *  line is acquired. 0 if no line is tracked.
+ */
+uint8_t get_line_track_id(void)
+{
+    return line_measure.id;
+}
+
+/*
+ *  Returns the confidence of the line tracked, from 0 (no line) to
+ *  TRACK_MAX_CONFIDENCE (line found in the last frames).
+ */
+uint8_t get_line_confidence(void)
+{
+    return line_measure.confidence;
+}
+
+/*
+ *  Returns the width in pixel of the line detected, 0 if no line is found.
+ */
+uint16_t get_line_width(void)
+{
+    return line_measure.width;
+}
+
+/*
+ *  Returns the contrast of the line detected: intensity threshold of the image
+ *  minus mean intensity of the line. 0 if no line is found.
+ */
+uint8_t get_line_contrast(void)
+{
+    return line_measure.contrast;
 }
 
 /*
@@ -48,98 +236,515 @@ uint16_t get_line_position(void)
 void select_color_detection(color_detection_t choice_detect_color)
 {
     detect_color = choice_detect_color;
+    // the intensities of the other channel are different
+    otsu_threshold = 0;
+    // the line of the other color is a new line
+    track_reset_request = true;
 }
 
 /*
- *  Update the static variable "line_position" to true (1) if a line is detected
- *  or false (0) if no line wider than MIN_LINE_WIDTH is detected.
- *  A line is detected performing an average of the intensity of all the pixels
- *  of the buffer. Then each pixel is compared to the mean until two pixel are
- *  at the opposite side of the mean at a distance of WIDTH_SLOPE from each other.
- *  Therefore a descending and ascending slope can be detected, implying that
- *  the camera detected a line of lower intensity compared to the mean.
+ *  Copies the heading and the curvature of the line measured on the lines ahead
+ *  of USED_LINE. Only valid in the CAPTURE_LOOKAHEAD mode, when the line is
+ *  found on all the lines processed.
  *
  *  params:
- *  uint8_t *buffer         Pointer to the buffer containing the intensity of
- *                          the pixel of the detected color.
+ *  lookahead_t *line_ahead     Measures of the line ahead.
  */
-void line_detection(uint8_t *buffer)
+void get_lookahead(lookahead_t *line_ahead)
 {
-    uint16_t i = 0, begin = 0, end = 0;
-    uint8_t stop = 0, wrong_line = 0;
-    // mean intensity of all the pixels (IMAGE_BUFFER_SIZE)
-    uint32_t mean = 0;
+    chSysLock();
+    *line_ahead = lookahead;
+    chSysUnlock();
+}
 
-    // performs an average (intensity pixel average)
-    for (uint16_t i = 0; i < IMAGE_BUFFER_SIZE; i++)
+/*
+ *  Set the method used to choose the intensity threshold of line_detection.
+ *
+ *  params:
+ *  threshold_mode_t mode       THRESHOLD_MEAN or THRESHOLD_OTSU.
+ */
+void select_threshold_mode(threshold_mode_t mode)
+{
+    threshold_mode = mode;
+}
+
+/*
+ *  Enables or disables the control of the exposure from the intensity of the
+ *  paper. When disabled, the automatic exposure of the sensor is used again.
+ *
+ *  params:
+ *  bool enable                 Control of the exposure by the image processing.
+ */
+void select_auto_exposure(bool enable)
+{
+    auto_exposure = enable;
+}
+
+/*
+ *  Set the capture mode of the camera. The camera is reconfigured before the
+ *  next frame. The greyscale modes only transfer the luminance and can be used
+ *  when the line is darker than the paper in every color.
+ *
+ *  params:
+ *  capture_mode_t mode         Capture mode.
+ */
+void select_capture_mode(capture_mode_t mode)
+{
+    capture_mode = mode;
+}
+
+/*
+ *  Copies the measures of a capture mode: frame period, processing time and
+ *  quality of the detection. The measures are kept when the mode changes.
+ *
+ *  params:
+ *  capture_mode_t mode                 Capture mode.
+ *  capture_benchmark_t *benchmark      Measures of the mode.
+ */
+void get_capture_benchmark(capture_mode_t mode, capture_benchmark_t *benchmark)
+{
+    chSysLock();
+    *benchmark = capture_benchmarks[mode];
+    chSysUnlock();
+}
+
+/*
+ *  Returns the system time of the capture of the frame used for the last
+ *  line detection, to know how old the line position is.
+ */
+systime_t get_line_timestamp(void)
+{
+    return line_measure.timestamp;
+}
+
+/*
+ *  Returns the realtime counter at the capture of the frame used for the last
+ *  line detection, to measure the latencies with a better precision than the
+ *  system time.
+ */
+rtcnt_t get_line_cycles(void)
+{
+    return line_measure.cycles;
+}
+
+/*
+ *  Records the latency of a stage of the line following: the time elapsed
+ *  since the capture of the frame. A stage must always be recorded by the
+ *  same thread.
+ *
+ *  params:
+ *  pipeline_stage_t stage      Stage just finished.
+ *  rtcnt_t frame_cycles        Realtime counter at the capture of the frame processed.
+ */
+void record_pipeline_latency(pipeline_stage_t stage, rtcnt_t frame_cycles)
+{
+    latency_record(&pipeline_latency[stage], latency_since(frame_cycles));
+}
+
+/*
+ *  Gives the minimum, mean, 99th percentile and maximum latency of a stage
+ *  of the line following since the previous call for this stage.
+ *
+ *  params:
+ *  pipeline_stage_t stage      Stage of the line following.
+ *  latency_report_t *report    Summary of the latencies to fill.
+ *  uint32_t *buckets           Array of LATENCY_BUCKETS elements filled with the
+ *                              histogram of the latencies (see latency_get_report).
+ */
+void get_pipeline_latency(pipeline_stage_t stage, latency_report_t *report, uint32_t *buckets)
+{
+    latency_get_report(&pipeline_latency[stage], report, buckets, true);
+}
+
+/*
+ *  Returns the number of frames captured per second while streaming in the
+ *  current capture mode, or 0 if the camera has not streamed in this mode yet.
+ */
+float get_frame_rate(void)
+{
+    float frame_period_ms = capture_benchmarks[frame_mode].frame_period_ms;
+    return (frame_period_ms > 0) ? 1000.0f / frame_period_ms : 0;
+}
+
+/*
+ *  Returns the number of line candidates found in the last processed image
+ *  and copies them in the array given.
+ *
+ *  params:
+ *  line_candidate_t *candidates    Array of at least MAX_LINE_CANDIDATES elements,
+ *                                  filled with the candidates from left to right.
+ */
+uint8_t get_line_candidates(line_candidate_t *candidates)
+{
+    chSysLock();
+    for (uint8_t i = 0; i < nb_line_candidates; i++)
+    {
+        candidates[i] = line_candidates[i];
+    }
+    uint8_t nb_candidates = nb_line_candidates;
+    chSysUnlock();
+
+    return nb_candidates;
+}
+
+/*
+ *  Returns the intensity threshold used to detect the line in the image just
+ *  extracted. With THRESHOLD_MEAN it is the mean intensity of the image.
+ *  With THRESHOLD_OTSU it is computed from the histogram with the Otsu method:
+ *  the threshold maximizing the variance between the dark pixels and the bright
+ *  pixels. It does not move when the line covers a large part of the image, unlike
+ *  the mean. The threshold is filtered from frame to frame, and kept if the image
+ *  has a single class of pixels (no line in view).
+ *
+ *  params:
+ *  uint32_t mean           Mean intensity of the image.
+ *  uint16_t size           Number of pixels of the image.
+ */
+static uint32_t compute_threshold(uint32_t mean, uint16_t size)
+{
+    if (threshold_mode == THRESHOLD_MEAN)
     {
-        mean += buffer[i];
+        return mean;
     }
-    mean /= IMAGE_BUFFER_SIZE;
 
-    do
+    // total variance and sum of the intensities of the pixels
+    float total_variance = 0, total_sum = (float)mean * size;
+    for (uint16_t i = 0; i < HISTOGRAM_SIZE; i++)
     {
-        line_found = 0;
-        wrong_line = 0;
-        // search for a begin (search for an descending slope)
-        while (stop == 0 && i < (IMAGE_BUFFER_SIZE - WIDTH_SLOPE))
+        total_variance += histogram[i] * ((float)i - mean) * ((float)i - mean);
+    }
+
+    // number and sum of the intensities of the dark pixels (intensity <= t)
+    float dark_count = 0, dark_sum = 0;
+    float best_variance = 0;
+    uint16_t best_first = 0, best_last = 0;
+    for (uint16_t t = 0; t < HISTOGRAM_SIZE - 1; t++)
+    {
+        dark_count += histogram[t];
+        dark_sum += (float)t * histogram[t];
+        float bright_count = size - dark_count;
+        if (dark_count == 0 || bright_count == 0)
         {
-            // the slope must at least be WIDTH_SLOPE wide
-            // the beginning of the slope must be higher in intensity than the mean, and the end of the slope lower
-            if (buffer[i] > mean && buffer[i + WIDTH_SLOPE] < mean)
-            {
-                begin = i;
-                stop = 1;
-            }
-            i++;
+            continue;
         }
-        // if a begin (descending slope) was found, search for an end (ascending slope)
-        if (i < (IMAGE_BUFFER_SIZE - WIDTH_SLOPE) && begin)
+        float dark_mean = dark_sum / dark_count;
+        float bright_mean = (total_sum - dark_sum) / bright_count;
+        float variance = dark_count * bright_count * (bright_mean - dark_mean) * (bright_mean - dark_mean) / size;
+        if (variance > best_variance)
         {
-            stop = 0;
-
-            while (stop == 0 && i < IMAGE_BUFFER_SIZE)
-            {
-                // the slope must at least be WIDTH_SLOPE wide
-                // the beginning of the slope must be lower in intensity than the mean, and the end of the slope higher
-                if (i > WIDTH_SLOPE && buffer[i] > mean && buffer[i - WIDTH_SLOPE] < mean)
-                {
-                    end = i;
-                    stop = 1;
-                    line_found = 1;
-                }
-                i++;
-            }
+            best_variance = variance;
+            best_first = t;
+            best_last = t;
         }
+        else if (variance == best_variance)
+        {
+            // the intensities are quantized: the best thresholds are the empty bins between two classes
+            best_last = t;
+        }
+    }
 
-        // if a line too small has been detected, continues the search
-        if (line_found && (end - begin) < MIN_LINE_WIDTH)
+    if (best_variance > OTSU_MIN_SEPARATION * total_variance)
+    {
+        // middle of the empty bins, just above the last dark intensity
+        float threshold = (best_first + best_last) / 2.0f + 1;
+        otsu_threshold += (otsu_threshold > 0) ? (threshold - otsu_threshold) / THRESHOLD_FILTER : threshold;
+    }
+    return (otsu_threshold > 0) ? (uint32_t)otsu_threshold : mean;
+}
+
+/*
+ *  Returns the exposure time reached by the automatic exposure of the sensor
+ *  (in lines of the sensor), read from its integration time registers, the ones
+ *  written by po8030_set_exposure, within the limits of the control.
+ *  Returns EXPOSURE_INITIAL if they cannot be read.
+ */
+static float read_sensor_exposure(void)
+{
+    uint8_t high = 0, middle = 0, low = 0;
+
+    if (write_reg(PO8030_ADDR, REG_BANK, BANK_B) != MSG_OK || read_reg(PO8030_ADDR, PO8030_REG_INTTIME_H, &high) != MSG_OK ||
+        read_reg(PO8030_ADDR, PO8030_REG_INTTIME_M, &middle) != MSG_OK || read_reg(PO8030_ADDR, PO8030_REG_INTTIME_L, &low) != MSG_OK)
+    {
+        return EXPOSURE_INITIAL;
+    }
+    // integral part in lines, fractional part in 1/256 line
+    float sensor_exposure = ((high << 8) | middle) + low / 256.0f;
+    sensor_exposure = (sensor_exposure > EXPOSURE_MAX) ? EXPOSURE_MAX : sensor_exposure;
+    return (sensor_exposure < EXPOSURE_MIN) ? EXPOSURE_MIN : sensor_exposure;
+}
+
+/*
+ *  Corrects the exposure time of the sensor so the paper keeps the intensity
+ *  EXPOSURE_TARGET whatever the lighting, and the contrast between the line and
+ *  the paper does not collapse (dark image) or saturate (bright image).
+ *  The intensity of the paper is the mean of the pixels brighter than the
+ *  threshold in the histogram of the image. The exposure is multiplied by the
+ *  ratio between the target and this intensity, at most EXPOSURE_MAX_STEP, and
+ *  corrected at most every EXPOSURE_PERIOD: each correction is a write over I2C
+ *  and is only applied by the sensor on the next frames.
+ *
+ *  params:
+ *  uint32_t threshold      Intensity threshold of the image.
+ *  systime_t time          Time of the capture of the image.
+ */
+static void control_exposure(uint32_t threshold, systime_t time)
+{
+    if (!auto_exposure)
+    {
+        if (exposure > 0)
         {
-            i = end;
-            begin = 0;
-            end = 0;
-            stop = 0;
-            wrong_line = 1;
+            po8030_set_ae(1);
+            exposure = 0;
         }
-    } while (wrong_line);
+        return;
+    }
+    if (exposure > 0 && ST2MS(time - exposure_time) < EXPOSURE_PERIOD)
+    {
+        return;
+    }
 
-    if (line_found)
+    // number, sum of the intensities and number of saturated pixels of the paper
+    uint32_t paper_count = 0, paper_sum = 0, saturated_count = 0;
+    for (uint16_t i = threshold + 1; i < HISTOGRAM_SIZE; i++)
     {
-        // if a line is found, line_position is update to the position of the line
-        line_position = (begin + end) / 2;
+        paper_count += histogram[i];
+        paper_sum += i * histogram[i];
+        saturated_count += (i >= EXPOSURE_SATURATED) ? histogram[i] : 0;
+    }
+    if (exposure == 0)
+    {
+        // the exposure is controlled here instead of the automatic exposure of the sensor,
+        // from the exposure it reached so the brightness of the image does not jump
+        po8030_set_ae(0);
+        exposure = read_sensor_exposure();
+        exposure_time = time;
+        return;
+    }
+    else if (paper_count > 0)
+    {
+        uint32_t paper_mean = paper_sum / paper_count;
+        if (saturated_count > paper_count / EXPOSURE_MAX_SATURATED)
+        {
+            exposure /= EXPOSURE_MAX_STEP;
+        }
+        else if (abs((int32_t)paper_mean - EXPOSURE_TARGET) > EXPOSURE_TOLERANCE)
+        {
+            float ratio = (float)EXPOSURE_TARGET / (paper_mean > 0 ? paper_mean : 1);
+            ratio = (ratio > EXPOSURE_MAX_STEP) ? EXPOSURE_MAX_STEP : ratio;
+            ratio = (ratio < 1 / EXPOSURE_MAX_STEP) ? 1 / EXPOSURE_MAX_STEP : ratio;
+            exposure *= ratio;
+        }
+        else
+        {
+            return;
+        }
+        exposure = (exposure > EXPOSURE_MAX) ? EXPOSURE_MAX : exposure;
+        exposure = (exposure < EXPOSURE_MIN) ? EXPOSURE_MIN : exposure;
     }
     else
     {
-        // if no line is found, line_position is update to it's initial value
-        line_position = IMAGE_BUFFER_SIZE / 2; // center
+        return;
+    }
+    // integral part in lines, fractional part in 1/256 line
+    po8030_set_exposure((uint16_t)exposure, (uint8_t)((exposure - (uint16_t)exposure) * 256));
+    exposure_time = time;
+}
+
+/*
+ *  Updates the static variables "line_found", "line_position" and the list of
+ *  line candidates with the dark segments of the buffer (see find_line_candidates).
+ *  line_position is the centroid of the candidate associated with the line
+ *  tracked in the previous frames (see track_line).
+ *
+ *  params:
+ *  uint8_t *buffer         Pointer to the buffer containing the intensity of
+ *                          the pixel of the detected color.
+ *  uint16_t size           Number of pixels of the buffer.
+ *  uint8_t subsampling     Horizontal subsampling of the buffer (1, 2 or 4).
+ *  uint32_t threshold      Intensity separating the line from the background.
+ */
+static void line_detection(uint8_t *buffer, uint16_t size, uint8_t subsampling, uint32_t threshold)
+{
+    // only used by the thread ProcessImage, outside of its working area
+    static line_candidate_t candidates[MAX_LINE_CANDIDATES];
+    uint8_t nb_candidates = find_line_candidates(buffer, size, subsampling, threshold, candidates);
+
+    chSysLock();
+    if (track_reset_request)
+    {
+        track.reset = true;
+        track_reset_request = false;
+    }
+    chSysUnlock();
+    track_line(&track, candidates, nb_candidates);
+    chSysLock();
+    for (uint8_t i = 0; i < nb_candidates; i++)
+    {
+        line_candidates[i] = candidates[i];
+    }
+    nb_line_candidates = nb_candidates;
+    line_found = (track.id != 0);
+    // rounded to the nearest pixel
+    line_position = (track.line.position + (1 << (LINE_POSITION_SHIFT - 1))) >> LINE_POSITION_SHIFT;
+    chSysUnlock();
+}
+
+/*
+ *  Publishes the line tracked in the frame just processed for the other threads
+ *  (see get_line_measure), unless the stream stopped since its capture.
+ *
+ *  params:
+ *  systime_t capture_time      System time of the capture of the frame.
+ *  rtcnt_t capture_cycles      Realtime counter at the capture of the frame.
+ *  uint32_t stream             Value of stream_stops at the capture of the frame.
+ */
+static void publish_line(systime_t capture_time, rtcnt_t capture_cycles, uint32_t stream)
+{
+    chSysLock();
+    if (stream == stream_stops)
+    {
+        line_measure.found = line_found;
+        line_measure.id = track.id;
+        line_measure.confidence = track.confidence;
+        line_measure.position = track.line.position;
+        line_measure.width = track.line.width;
+        line_measure.contrast = track.line.contrast;
+        line_measure.timestamp = capture_time;
+        line_measure.cycles = capture_cycles;
+    }
+    chSysUnlock();
+}
+
+/*
+ *  Stops the stream of the camera. The line published is withdrawn and the
+ *  tracking restarts with the next stream: the robot moves without the camera
+ *  (rotations), the last line seen is not where the robot is any more.
+ */
+static void stop_stream(void)
+{
+    dcmi_capture_stop();
+    chSysLock();
+    stream_stops++;
+    line_measure.found = false;
+    line_measure.id = 0;
+    line_measure.confidence = 0;
+    track_reset_request = true;
+    chSysUnlock();
+}
+
+/*
+ *  Fills the buffer "image" with the intensity of the pixels of one line of the
+ *  image, depending on the format of the capture mode and of the color to detect,
+ *  and returns the sum of the intensities. The histogram is updated.
+ *
+ *  params:
+ *  const capture_config_t *config  Configuration of the capture mode of the image.
+ *  const uint8_t *line_ptr         First line to combine of the image.
+ *  uint8_t *image                  Buffer of "size" pixels to fill.
+ *  uint16_t size                   Number of pixels of a line.
+ */
+static uint32_t extract_image(const capture_config_t *config, const uint8_t *line_ptr, uint8_t *image, uint16_t size)
+{
+    if (config->format == FORMAT_YYYY)
+    {
+        return extract_grey_lines(line_ptr, image, histogram, size);
     }
+    return extract_color_lines(line_ptr, image, histogram, size, detect_color, config->classify);
+}
+
+/*
+ *  Measures the heading and the curvature of the line, and updates the static
+ *  variable "lookahead". The line is searched on the middle and far lines
+ *  (LOOKAHEAD_STEP and 2 * LOOKAHEAD_STEP before USED_LINE): on each line, the
+ *  candidate closest to the line found on the previous (nearer) line is kept.
+ *  A junction is announced if a line ahead has more than one candidate, or a
+ *  candidate much wider than the line followed (crossing line).
+ *
+ *  params:
+ *  const uint8_t *img_buff_ptr     Image captured in the look-ahead mode.
+ *  uint8_t *image                  Buffer of "size" pixels used for the extraction.
+ *  uint16_t size                   Number of pixels of a line.
+ *  uint32_t threshold              Intensity threshold of the line USED_LINE.
+ */
+static void look_ahead(const uint8_t *img_buff_ptr, uint8_t *image, uint16_t size, uint32_t threshold)
+{
+    const capture_config_t *config = &capture_configs[CAPTURE_LOOKAHEAD];
+    // only used by the thread ProcessImage, outside of its working area
+    static line_candidate_t candidates[MAX_LINE_CANDIDATES];
+    // positions of the line from the near line (USED_LINE) to the far line (in pixel)
+    float positions[LOOKAHEAD_ROWS];
+    lookahead_t line_ahead = {.valid = line_found};
+
+    positions[0] = (float)track.line.position / (1 << LINE_POSITION_SHIFT);
+    for (uint8_t row = 1; row < LOOKAHEAD_ROWS && line_ahead.valid; row++)
+    {
+        // far rows are at the beginning of the image
+        const uint8_t *line_ptr = img_buff_ptr + LOOKAHEAD_NEAR_OFFSET - row * LOOKAHEAD_ROW_OFFSET;
+        extract_image(config, line_ptr, image, size);
+        uint8_t nb_candidates = find_line_candidates(image, size, config->factor, threshold, candidates);
+
+        const line_candidate_t *closest = NULL;
+        for (uint8_t i = 0; i < nb_candidates; i++)
+        {
+            if (candidates[i].width > 2 * track.line.width)
+            {
+                line_ahead.junction = true;
+            }
+            float distance = fabsf((float)candidates[i].position / (1 << LINE_POSITION_SHIFT) - positions[row - 1]);
+            if (closest == NULL || distance < fabsf((float)closest->position / (1 << LINE_POSITION_SHIFT) - positions[row - 1]))
+            {
+                closest = &candidates[i];
+            }
+        }
+        line_ahead.junction |= (nb_candidates > 1);
+        line_ahead.valid = (closest != NULL);
+        if (closest != NULL)
+        {
+            positions[row] = (float)closest->position / (1 << LINE_POSITION_SHIFT);
+        }
+    }
+
+    if (line_ahead.valid)
+    {
+        // slope and second difference of the positions, per line of the sensor
+        line_ahead.heading = (positions[2] - positions[0]) / (2 * LOOKAHEAD_STEP);
+        line_ahead.curvature = (positions[2] - 2 * positions[1] + positions[0]) / (LOOKAHEAD_STEP * LOOKAHEAD_STEP);
+    }
+
+    chSysLock();
+    lookahead = line_ahead;
+    chSysUnlock();
+}
+
+/*
+ *  Configures the camera for a capture mode: window of lines, format and
+ *  subsampling of the mode. The buffers of the dcmi
+ *  are reallocated to the size of the new image, so they must not be in use.
+ *
+ *  params:
+ *  capture_mode_t mode         Capture mode.
+ */
+static void configure_camera(capture_mode_t mode)
+{
+    const capture_config_t *config = &capture_configs[mode];
+
+    dcmi_unprepare();
+    // Captures pixels from 0 to IMAGE_BUFFER_SIZE of the window of lines of the mode
+    po8030_advanced_config(config->format, 0, config->first_line, IMAGE_BUFFER_SIZE, config->nb_lines,
+                           config->subsampling, config->subsampling_y);
+    dcmi_prepare();
 }
 
 /*
  *  Thread that calls functions from dcmi_camera.c to capture the intensity of
  *  pixels from two lines of the camera. The pixels intensity is stored in RGB565
- *  format. The thread uses a semaphore to communicate with the ProcessImage
+ *  or greyscale format depending on the capture mode. The thread uses a semaphore
+ *  to communicate with the ProcessImage
  *  thread indicating that an image is ready.
+ *  While the robot follows a line, the camera streams continuously in double
+ *  buffering: the DMA fills one buffer while the other one is processed, so the
+ *  ProcessImage thread always gets the last frame captured. The stream is stopped
+ *  in the other states of the FSM.
  */
 static THD_WORKING_AREA(waCaptureImage, 256);
 static THD_FUNCTION(CaptureImage, arg)
@@ -148,30 +753,168 @@ static THD_FUNCTION(CaptureImage, arg)
     chRegSetThreadName(__FUNCTION__);
     (void)arg;
 
-    // Captures pixels from 0 to IMAGE_BUFFER_SIZE of the lines USED_LINE and USED_LINE + 1 in RGB565 format
-    po8030_advanced_config(FORMAT_RGB565, 0, USED_LINE, IMAGE_BUFFER_SIZE, 2, SUBSAMPLING_X1, SUBSAMPLING_X1);
+    bool streaming = false;
+    // time of the previous frame, to measure the frame period
+    systime_t previous_frame_time = 0;
+    capture_mode_t configured_mode = capture_mode;
+
     dcmi_enable_double_buffering();
-    dcmi_set_capture_mode(CAPTURE_ONE_SHOT);
+    dcmi_set_capture_mode(CAPTURE_CONTINUOUS);
+    po8030_advanced_config(capture_configs[configured_mode].format, 0, capture_configs[configured_mode].first_line,
+                           IMAGE_BUFFER_SIZE, capture_configs[configured_mode].nb_lines,
+                           capture_configs[configured_mode].subsampling, capture_configs[configured_mode].subsampling_y);
     dcmi_prepare();
 
     while (1)
     {
+        if (capture_mode != configured_mode)
+        {
+            if (streaming)
+            {
+                stop_stream();
+                streaming = false;
+            }
+            // waits the end of the processing of the current image before freeing its buffer
+            chMtxLock(&image_buffer_mtx);
+            configured_mode = capture_mode;
+            configure_camera(configured_mode);
+            chMtxUnlock(&image_buffer_mtx);
+        }
+
         FSM_STATE current_state = get_FSM_state();
-        if (current_state == STRING_POSITION || current_state == FREQUENCY_POSITION)
+        if (current_state == STRING_POSITION || current_state == FREQUENCY_POSITION || current_state == STRING_CENTER)
         {
-            dcmi_capture_start();
+            if (!streaming)
+            {
+                dcmi_capture_start();
+                streaming = true;
+                previous_frame_time = 0;
+            }
+            // waits for the end of the frame, the next one is already being captured in the other buffer
             wait_image_ready();
+            rtcnt_t cycles = latency_start();
+            systime_t time = chVTGetSystemTime();
+
+            chSysLock();
+            frame_timestamp = time;
+            frame_cycles = cycles;
+            frame_mode = configured_mode;
+            frame_stream = stream_stops;
+            if (previous_frame_time)
+            {
+                float period = ST2MS(time - previous_frame_time);
+                float *frame_period_ms = &capture_benchmarks[configured_mode].frame_period_ms;
+                // exponential moving average of the frame period, weight 1/FRAME_PERIOD_FILTER
+                *frame_period_ms += (*frame_period_ms > 0) ? (period - *frame_period_ms) / FRAME_PERIOD_FILTER : period;
+            }
+            chSysUnlock();
+            previous_frame_time = time;
+
             // signals an image has been captured
             chBSemSignal(&image_ready_sem);
         }
-        chThdSleepMilliseconds(200);
+        else
+        {
+            if (streaming)
+            {
+                stop_stream();
+                streaming = false;
+            }
+            chThdSleepMilliseconds(10);
+        }
+    }
+}
+
+#ifdef CAPTURE
+/*
+ *  Copies the lines of a frame with its time and the color followed, for the
+ *  SendFrame thread. The frame is dropped if the previous one is still being
+ *  sent, so the line following never waits for the USB.
+ *
+ *  params:
+ *  const uint8_t *img_buff_ptr     Image captured, CAPTURED_LINES lines in RGB565.
+ *  systime_t capture_time          Time of the capture of the image.
+ *  bool classify                   The pixels are classified by color.
+ */
+static void capture_frame(const uint8_t *img_buff_ptr, systime_t capture_time, bool classify)
+{
+    if (chBSemWaitTimeout(&capture_free_sem, TIME_IMMEDIATE) != MSG_OK)
+    {
+        return;
+    }
+    memcpy(capture_header.magic, FRAME_CAPTURE_MAGIC, FRAME_CAPTURE_MAGIC_SIZE);
+    capture_header.timestamp_ms = ST2MS(capture_time);
+    capture_header.size = FRAME_CAPTURE_PIXELS_SIZE;
+    capture_header.color = detect_color;
+    capture_header.flags = classify ? FRAME_CAPTURE_CLASSIFIED : 0;
+    memcpy(capture_pixels, img_buff_ptr, FRAME_CAPTURE_PIXELS_SIZE);
+    chBSemSignal(&capture_ready_sem);
+}
+
+/*
+ *  Thread that sends the frames copied by capture_frame over USB (see
+ *  frame_capture.h), to replay them on a computer with host/frame_replay.
+ *  The frames are not sent while the USB is not connected.
+ */
+static THD_WORKING_AREA(waSendFrame, 256);
+static THD_FUNCTION(SendFrame, arg)
+{
+    chRegSetThreadName(__FUNCTION__);
+    (void)arg;
+
+    while (1)
+    {
+        chBSemWait(&capture_ready_sem);
+        if (SDU1.config->usbp->state == USB_ACTIVE)
+        {
+            chSequentialStreamWrite((BaseSequentialStream *)&SDU1, (uint8_t *)&capture_header, sizeof(capture_header));
+            chSequentialStreamWrite((BaseSequentialStream *)&SDU1, capture_pixels, FRAME_CAPTURE_PIXELS_SIZE);
+        }
+        chBSemSignal(&capture_free_sem);
     }
 }
+#endif
+
+/*
+ *  Updates the measures of a capture mode with the image just processed.
+ *
+ *  params:
+ *  capture_mode_t mode         Capture mode of the image.
+ *  uint32_t process_time_us    Time spent to process the image (in us).
+ */
+static void update_capture_benchmark(capture_mode_t mode, uint32_t process_time_us)
+{
+    static uint16_t previous_position = IMAGE_BUFFER_SIZE / 2;
+    static bool previous_found = false;
+    capture_benchmark_t *benchmark = &capture_benchmarks[mode];
+
+    chSysLock();
+    benchmark->frames++;
+    // exponential moving average of the processing time, weight 1/FRAME_PERIOD_FILTER
+    benchmark->process_time_us += (benchmark->frames > 1) ? ((float)process_time_us - benchmark->process_time_us) / FRAME_PERIOD_FILTER
+                                                          : process_time_us;
+    if (line_found)
+    {
+        benchmark->lines_found++;
+        if (previous_found)
+        {
+            // frame to frame variation of the position, the noise of the detection when the robot goes straight
+            benchmark->position_jitter += (abs(line_position - previous_position) - benchmark->position_jitter) / FRAME_PERIOD_FILTER;
+        }
+    }
+    previous_position = line_position;
+    previous_found = line_found;
+    chSysUnlock();
+}
 
 /*
  *  Thread that process only one line of the image captured. Depending
  *  of wich color we want to detect, this thread process only the intensity
- *  of the pixels of the color chosen.
+ *  of the pixels of the color chosen. The COMBINED_LINES first lines captured
+ *  are averaged pixel by pixel to reduce the noise of the sensor.
+ *  In the greyscale modes the luminance is used directly, whatever the color.
+ *  In the classified mode, each pixel is classified by color with a table and
+ *  the line of the color followed is dark, any other pixel is bright.
  */
 static THD_WORKING_AREA(waProcessImage, 1024);
 static THD_FUNCTION(ProcessImage, arg)
@@ -179,45 +922,70 @@ static THD_FUNCTION(ProcessImage, arg)
     chRegSetThreadName(__FUNCTION__);
     (void)arg;
 
-    // pointer to the address filled with the last image in RGB565
+    // pointer to the address filled with the last image captured
     uint8_t *img_buff_ptr;
-    // array containing only the intensity of the pixel of the color chosen
-    uint8_t image[IMAGE_BUFFER_SIZE] = {0}; // initialized to 0
+    // array containing only the intensity of the pixel of the color chosen,
+    // static as the buffers of the detection: the frame would fill most of the working area
+    static uint8_t image[IMAGE_BUFFER_SIZE] = {0}; // initialized to 0
+    // sum of the intensity of all the pixels of image, computed during the extraction
+    uint32_t image_sum = 0;
 
     while (1)
     {
         chBSemWait(&image_ready_sem);
-        // gets the pointer to the array filled with the last image in RGB565
+        chMtxLock(&image_buffer_mtx);
+        rtcnt_t start = chSysGetRealtimeCounterX();
+        // gets the pointer to the array filled with the last image
         img_buff_ptr = dcmi_get_last_image_ptr();
 
-        switch (detect_color)
+        chSysLock();
+        // time of the capture of this image and its format
+        systime_t capture_time = frame_timestamp;
+        rtcnt_t capture_cycles = frame_cycles;
+        capture_mode_t mode = frame_mode;
+        uint32_t stream = frame_stream;
+        chSysUnlock();
+        const capture_config_t *config = &capture_configs[mode];
+        // number of pixels of a line
+        uint16_t size = IMAGE_BUFFER_SIZE / config->factor;
+#ifdef CAPTURE
+        // only the full RGB565 lines, the format replayed
+        if (config->format == FORMAT_RGB565 && config->factor == 1 && !config->lookahead)
         {
-        case RED_COLOR:
-            // Extracts only the red pixels
-            for (uint16_t i = 0; i < (2 * IMAGE_BUFFER_SIZE); i += 2)
-            {
-                image[i / 2] = (uint8_t)img_buff_ptr[i] & 0xF8;
-            }
-            break;
-        case GREEN_COLOR:
-            // Extracts only the green pixels
-            for (uint16_t i = 0; i < (2 * IMAGE_BUFFER_SIZE); i += 2)
-            {
-                // extracts 3 LSbits of the first byte and the 3 MSbits of second byte
-                image[i / 2] = (((uint8_t)img_buff_ptr[i] & 0x07) << 5) + (((uint8_t)img_buff_ptr[i + 1] & 0xE0) >> 3);
-            }
-            break;
-        case BLUE_COLOR:
-            // Extracts only the blue pixels
-            for (uint16_t i = 0; i < (2 * IMAGE_BUFFER_SIZE); i += 2)
-            {
-                // extracts 5 LSbits of the LSByte (Second byte in big-endian format)
-                image[i / 2] = ((uint8_t)img_buff_ptr[i + 1] & 0x1F) << 3;
-            }
-            break;
+            capture_frame(img_buff_ptr, capture_time, config->classify);
+        }
+#endif
+
+        for (uint16_t i = 0; i < HISTOGRAM_SIZE; i++)
+        {
+            histogram[i] = 0;
+        }
+
+        // the lines combined for USED_LINE are the last ones of the image
+        image_sum = extract_image(config, img_buff_ptr + (config->lookahead ? LOOKAHEAD_NEAR_OFFSET : 0), image, size);
+        record_pipeline_latency(STAGE_EXTRACTION, capture_cycles);
+        uint32_t threshold = compute_threshold(image_sum / size, size);
+        if (!config->classify)
+        {
+            // the classified pixels have fixed intensities
+            control_exposure(threshold, capture_time);
+        }
+        line_detection(image, size, config->factor, threshold);
+        publish_line(capture_time, capture_cycles, stream);
+        if (config->lookahead)
+        {
+            look_ahead(img_buff_ptr, image, size, threshold);
+        }
+        else
+        {
+            chSysLock();
+            lookahead.valid = false;
+            chSysUnlock();
         }
+        chMtxUnlock(&image_buffer_mtx);
+        record_pipeline_latency(STAGE_DETECTION, capture_cycles);
 
-        line_detection(image);
+        update_capture_benchmark(mode, (chSysGetRealtimeCounterX() - start) / CYCLES_PER_US);
     }
 }
 
@@ -228,4 +996,7 @@ void image_processing_start(void)
 {
     chThdCreateStatic(waCaptureImage, sizeof(waCaptureImage), NORMALPRIO, CaptureImage, NULL);
     chThdCreateStatic(waProcessImage, sizeof(waProcessImage), NORMALPRIO, ProcessImage, NULL);
+#ifdef CAPTURE
+    chThdCreateStatic(waSendFrame, sizeof(waSendFrame), NORMALPRIO - 1, SendFrame, NULL);
+#endif
 }
@@ -1,20 +1,93 @@
 #ifndef IMAGE_PROCESSING_H
 #define IMAGE_PROCESSING_H
 
-// number of pixel captured by the image for each line
-#define IMAGE_BUFFER_SIZE 640
+#include "latency.h"
+#include "line_detection.h"
 
-// List of detection color
+// ground seen by the line of the sensor used for the tracking: distance ahead of the center of the
+// robot (in mm), and displacement of the line in the image for a lateral displacement of 1 mm there (in pixel)
+#define VIEW_DISTANCE 95.0f
+#define PIXELS_PER_MM 11.0f
+
+// Format of the image captured by the camera
+typedef enum
+{
+    CAPTURE_RGB565 = 0,   // 2 bytes per pixel, the channel of the color to detect is used
+    CAPTURE_GREYSCALE,    // luminance only, 1 byte per pixel: half of the transfer and of the buffer
+    CAPTURE_GREYSCALE_X2, // luminance subsampled by 2 horizontally: quarter of the transfer and of the buffer
+    CAPTURE_RGB565_CLASSIFIED, // 2 bytes per pixel, each pixel is classified by color (paper, red, blue, dark)
+    CAPTURE_LOOKAHEAD,    // RGB565 subsampled by 4, lines ahead of USED_LINE processed too (heading, curvature)
+    NB_CAPTURE_MODES
+} capture_mode_t;
+
+// Line seen ahead of the line used for the tracking
+typedef struct
+{
+    bool valid;      // the line is found on all the lines processed
+    bool junction;   // another line or a crossing is ahead
+    float heading;   // lateral displacement of the line per line of the sensor, towards the far line (pixel/line)
+    float curvature; // variation of the heading per line of the sensor (pixel/line^2)
+} lookahead_t;
+
+// Method used to choose the intensity separating the line from the background
+typedef enum
+{
+    THRESHOLD_MEAN = 0, // mean intensity of the image
+    THRESHOLD_OTSU,     // Otsu threshold of the histogram, carried from frame to frame
+} threshold_mode_t;
+
+// Measures of a capture mode, to compare the modes on the robot
+typedef struct
+{
+    uint32_t frames;         // number of frames processed
+    uint32_t lines_found;    // number of frames where a line was detected
+    float frame_period_ms;   // filtered period between two frames
+    float process_time_us;   // filtered time to extract the line and detect the line
+    float position_jitter;   // filtered variation of line_position between two frames (in pixel)
+} capture_benchmark_t;
+
+// Line detected in a frame, published as a whole by the thread ProcessImage
+typedef struct
+{
+    bool found;          // a line is tracked (found in the last frames)
+    uint8_t id;          // identifier of the line tracked, changes each time a new line is acquired, 0 if none
+    uint8_t confidence;  // from 0 (no line) to TRACK_MAX_CONFIDENCE
+    uint16_t position;   // centroid with LINE_POSITION_SHIFT fractional bits
+    uint16_t width;      // in pixel
+    uint8_t contrast;    // intensity threshold of the image minus mean intensity of the line
+    systime_t timestamp; // system time of the capture of the frame
+    rtcnt_t cycles;      // realtime counter at the capture of the frame
+} line_measure_t;
+
+// Stages of the line following, their latency is measured from the end of the capture of the frame
 typedef enum
 {
-    RED_COLOR,
-    GREEN_COLOR,
-    BLUE_COLOR,
-} color_detection_t;
+    STAGE_EXTRACTION = 0, // pixels of the color extracted
+    STAGE_DETECTION,      // line detected and tracked
+    STAGE_COMMAND,        // motors commanded from the line position
+    NB_PIPELINE_STAGES,
+} pipeline_stage_t;
 
 bool get_line_detection(void);
+void get_line_measure(line_measure_t *measure);
 uint16_t get_line_position(void);
+uint16_t get_line_position_fine(void);
+uint8_t get_line_track_id(void);
+uint8_t get_line_confidence(void);
+uint16_t get_line_width(void);
+uint8_t get_line_contrast(void);
+uint8_t get_line_candidates(line_candidate_t *candidates);
+systime_t get_line_timestamp(void);
+rtcnt_t get_line_cycles(void);
+void record_pipeline_latency(pipeline_stage_t stage, rtcnt_t frame_cycles);
+void get_pipeline_latency(pipeline_stage_t stage, latency_report_t *report, uint32_t *buckets);
+float get_frame_rate(void);
 void select_color_detection(color_detection_t choice_detect_color);
+void select_capture_mode(capture_mode_t mode);
+void select_threshold_mode(threshold_mode_t mode);
+void select_auto_exposure(bool enable);
+void get_lookahead(lookahead_t *line_ahead);
+void get_capture_benchmark(capture_mode_t mode, capture_benchmark_t *benchmark);
 void image_processing_start(void);
 
 #endif /* IMAGE_PROCESSING_H */
\ No newline at end of file
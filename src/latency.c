@@ -0,0 +1,223 @@
+#include <ch.h>
+#include <hal.h>
+
+// the realtime counter counts the cycles on the robot, and the virtual time in the simulator (src/host),
+// the other tools of src/host measure the time with the clock of the computer
+#if defined(__arm__) || defined(HOST_VIRTUAL_CLOCK)
+#define LATENCY_REALTIME_COUNTER
+#else
+#include <time.h>
+#endif
+
+#include "latency.h"
+
+#if defined(LATENCY_REALTIME_COUNTER)
+// number of cycles of the realtime counter in one microsecond
+#define CYCLES_PER_US (STM32_SYSCLK / 1000000)
+#endif
+// number of buckets for each power of 2 (2 bits of mantissa)
+#define BUCKETS_PER_OCTAVE 4
+
+/*
+ *  Returns the bucket of a latency: the latencies under BUCKETS_PER_OCTAVE have
+ *  their own bucket, then each power of 2 is split into BUCKETS_PER_OCTAVE
+ *  buckets, so the precision is 25% of the latency whatever its magnitude.
+ *
+ *  params:
+ *  uint32_t latency        Latency in [us].
+ */
+static uint8_t bucket_index(uint32_t latency)
+{
+    if (latency < BUCKETS_PER_OCTAVE)
+    {
+        return latency;
+    }
+    // position of the most significant bit, at least 2
+    uint8_t octave = 31 - __builtin_clz(latency);
+    uint32_t index = BUCKETS_PER_OCTAVE * (octave - 1) + ((latency >> (octave - 2)) & (BUCKETS_PER_OCTAVE - 1));
+    return (index < LATENCY_BUCKETS) ? index : LATENCY_BUCKETS - 1;
+}
+
+/*
+ *  Returns the smallest latency of a bucket (in [us]).
+ *
+ *  params:
+ *  uint8_t index           Bucket.
+ */
+uint32_t latency_bucket_start(uint8_t index)
+{
+    if (index < BUCKETS_PER_OCTAVE)
+    {
+        return index;
+    }
+    uint8_t octave = index / BUCKETS_PER_OCTAVE + 1;
+    return (uint32_t)(BUCKETS_PER_OCTAVE + index % BUCKETS_PER_OCTAVE) << (octave - 2);
+}
+
+#if defined(LATENCY_REALTIME_COUNTER)
+/*
+ *  Returns the realtime counter (DWT cycle counter), to give to latency_since.
+ */
+rtcnt_t latency_start(void)
+{
+    return chSysGetRealtimeCounterX();
+}
+
+/*
+ *  Returns the time elapsed since a value of the realtime counter, in [us].
+ *  The counter wraps around after about 25 s at 168 MHz.
+ *
+ *  params:
+ *  rtcnt_t start           Value of the realtime counter at the start.
+ */
+uint32_t latency_since(rtcnt_t start)
+{
+    return (chSysGetRealtimeCounterX() - start) / CYCLES_PER_US;
+}
+#else
+/*
+ *  Returns the monotonic clock of the host in [us], to give to latency_since.
+ *  Without cycle counter, the host build measures the time with the clock.
+ */
+rtcnt_t latency_start(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (rtcnt_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+/*
+ *  Returns the time elapsed since a value of the clock, in [us].
+ *
+ *  params:
+ *  rtcnt_t start           Value of the clock at the start.
+ */
+uint32_t latency_since(rtcnt_t start)
+{
+    return latency_start() - start;
+}
+#endif
+
+/*
+ *  Adds a latency to the measures. Only one thread may record in the same
+ *  measures. The sequence number is odd during the update, so a reader
+ *  preempting the writer sees it and reads again: neither waits for the other.
+ *  The measures are cleared first if they are the ones reported with a reset
+ *  (nothing recorded since). If latencies were recorded between the report and
+ *  the reset, they are kept with the ones reported instead of being lost.
+ *
+ *  params:
+ *  latency_stats_t *stats      Measures updated.
+ *  uint32_t latency            Latency in [us].
+ */
+void latency_record(latency_stats_t *stats, uint32_t latency)
+{
+    bool reset = (stats->sequence == stats->reset_sequence);
+
+    stats->sequence++;
+    __sync_synchronize();
+
+    if (reset)
+    {
+        stats->count = 0;
+        stats->sum = 0;
+        for (uint8_t i = 0; i < LATENCY_BUCKETS && stats->buckets != NULL; i++)
+        {
+            stats->buckets[i] = 0;
+        }
+    }
+    stats->min = (stats->count == 0 || latency < stats->min) ? latency : stats->min;
+    stats->max = (stats->count == 0 || latency > stats->max) ? latency : stats->max;
+    stats->count++;
+    stats->sum += latency;
+    if (stats->buckets != NULL)
+    {
+        stats->buckets[bucket_index(latency)]++;
+    }
+
+    __sync_synchronize();
+    stats->sequence++;
+}
+
+/*
+ *  Copies the measures without stopping the writer: the copy is done again if
+ *  the writer updated them in the meantime. Measures already reported with a
+ *  reset are copied as empty. The histogram is copied as empty if the measures
+ *  have none.
+ *
+ *  params:
+ *  latency_stats_t *stats      Measures read.
+ *  latency_stats_t *copy       Copy to fill, its sequence is the one of the measures copied.
+ *  uint32_t *buckets           Array of LATENCY_BUCKETS elements filled with the histogram, or NULL.
+ */
+static void read_stats(latency_stats_t *stats, latency_stats_t *copy, uint32_t *buckets)
+{
+    uint32_t sequence;
+
+    do
+    {
+        sequence = stats->sequence;
+        __sync_synchronize();
+        *copy = *stats;
+        for (uint8_t i = 0; i < LATENCY_BUCKETS && buckets != NULL; i++)
+        {
+            buckets[i] = (stats->buckets != NULL) ? stats->buckets[i] : 0;
+        }
+        __sync_synchronize();
+    } while ((sequence & 1) || sequence != stats->sequence);
+
+    copy->sequence = sequence;
+    if (sequence == copy->reset_sequence)
+    {
+        copy->count = 0;
+        for (uint8_t i = 0; i < LATENCY_BUCKETS && buckets != NULL; i++)
+        {
+            buckets[i] = 0;
+        }
+    }
+}
+
+/*
+ *  Computes the summary of the measures: minimum, mean, 99th percentile and
+ *  maximum. The measures are copied again if the writer updated them during
+ *  the copy. With "reset", the writer clears the measures reported at its next
+ *  record, so the next report only covers the latencies recorded after this one.
+ *  Only one thread may report with a reset on the same measures.
+ *
+ *  params:
+ *  latency_stats_t *stats      Measures read.
+ *  latency_report_t *report    Summary to fill, count is 0 if there is no measure.
+ *  uint32_t *buckets           Array of LATENCY_BUCKETS elements filled with the histogram,
+ *                              or NULL: the 99th percentile is then 0.
+ *  bool reset                  Clears the measures after the report.
+ */
+void latency_get_report(latency_stats_t *stats, latency_report_t *report, uint32_t *buckets, bool reset)
+{
+    latency_stats_t copy;
+
+    read_stats(stats, &copy, buckets);
+    report->count = copy.count;
+    report->min = copy.count ? copy.min : 0;
+    report->max = copy.count ? copy.max : 0;
+    report->mean = copy.count ? copy.sum / copy.count : 0;
+    report->p99 = 0;
+
+    // first bucket reaching 99% of the latencies
+    uint32_t cumulated = 0;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS && copy.count && copy.buckets != NULL && buckets != NULL; i++)
+    {
+        cumulated += buckets[i];
+        if (100 * cumulated >= 99 * copy.count)
+        {
+            uint32_t end = (i + 1 < LATENCY_BUCKETS) ? latency_bucket_start(i + 1) - 1 : copy.max;
+            report->p99 = (end < copy.max) ? end : copy.max;
+            break;
+        }
+    }
+
+    if (reset)
+    {
+        // the writer clears the measures only if nothing was recorded since the copy
+        stats->reset_sequence = copy.sequence;
+    }
+}
@@ -0,0 +1,36 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+// number of buckets of the histogram of the latencies: 4 buckets per power of 2, from 1 us to 16 s
+#define LATENCY_BUCKETS 96
+
+// Latencies measured by one thread (the writer) and read by another, without lock.
+// The histogram, and so the 99th percentile, is only kept if "buckets" gives it a place.
+typedef struct
+{
+    volatile uint32_t sequence;       // odd while the writer updates the measures
+    volatile uint32_t reset_sequence; // sequence of the last measures reported with a reset, set by the reader
+    uint32_t count;
+    uint32_t min;                    // in [us]
+    uint32_t max;                    // in [us]
+    uint64_t sum;                    // in [us]
+    uint32_t *buckets;               // LATENCY_BUCKETS counters of the histogram, or NULL
+} latency_stats_t;
+
+// Summary of the latencies
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;  // in [us]
+    uint32_t mean; // in [us]
+    uint32_t p99;  // in [us], upper bound of the bucket of the 99th percentile, 0 without histogram
+    uint32_t max;  // in [us]
+} latency_report_t;
+
+rtcnt_t latency_start(void);
+uint32_t latency_since(rtcnt_t start);
+void latency_record(latency_stats_t *stats, uint32_t latency);
+void latency_get_report(latency_stats_t *stats, latency_report_t *report, uint32_t *buckets, bool reset);
+uint32_t latency_bucket_start(uint8_t index);
+
+#endif /* LATENCY_H */
@@ -0,0 +1,398 @@
+#include <stdlib.h>
+
+#include "line_detection.h"
+#include "class_table.h"
+
+// width of the slope of pixel intensity (in pixel)
+#define WIDTH_SLOPE 5
+// minimum width of the line detected (in pixel)
+#define MIN_LINE_WIDTH 80
+// maximum distance between a candidate and the tracked line to be associated (in pixel)
+#define TRACK_MAX_JUMP 120
+// cost of a difference of width of 1 pixel, compared to a difference of position of 1 pixel
+#define TRACK_WIDTH_WEIGHT 0.5f
+// confidence gained when the line is found again, lost when it is missing (max TRACK_MAX_CONFIDENCE)
+#define TRACK_CONFIDENCE_GAIN 25
+#define TRACK_CONFIDENCE_LOSS 20
+#define TRACK_MAX_CONFIDENCE 100
+// bits of the classes dark for each color detected (see pixel_class_t). As with one channel,
+// the line followed is dark: the blue line in red, the red line in blue, both in green.
+// The black squares of the junctions (PIXEL_DARK) have both bits and are dark in every channel.
+#define CLASS_DARK_IN_RED PIXEL_BLUE
+#define CLASS_DARK_IN_GREEN (PIXEL_RED | PIXEL_BLUE)
+#define CLASS_DARK_IN_BLUE PIXEL_RED
+
+/*
+ *  Associates the candidates of the frame with the line tracked in the previous
+ *  frames, and updates the track.
+ *  The candidate closest to the tracked line (position and width) is kept if it
+ *  is not further than TRACK_MAX_JUMP, so a second line crossing the view (a
+ *  junction) does not steal the tracking. If no candidate is associated, the
+ *  line keeps its last position and loses confidence: it is only lost when the
+ *  confidence reaches 0, so a line missing in a few frames does not stop the robot.
+ *  Without tracked line, the candidate closest to the center of the image
+ *  starts a new track.
+ *
+ *  params:
+ *  line_track_t *track                     Line tracked, restarted first if its reset is set.
+ *  const line_candidate_t *candidates      Candidates of the frame.
+ *  uint8_t nb_candidates                   Number of candidates.
+ */
+void track_line(line_track_t *track, const line_candidate_t *candidates, uint8_t nb_candidates)
+{
+    const line_candidate_t *best = NULL;
+    float best_cost = 0;
+
+    if (track->reset)
+    {
+        track->id = 0;
+        track->confidence = 0;
+        track->reset = false;
+    }
+
+    for (uint8_t i = 0; i < nb_candidates; i++)
+    {
+        float cost;
+        if (track->id)
+        {
+            int16_t jump = abs(candidates[i].position - track->line.position) >> LINE_POSITION_SHIFT;
+            if (jump > TRACK_MAX_JUMP)
+            {
+                continue;
+            }
+            cost = jump + TRACK_WIDTH_WEIGHT * abs(candidates[i].width - track->line.width);
+        }
+        else
+        {
+            cost = abs(candidates[i].position - ((IMAGE_BUFFER_SIZE / 2) << LINE_POSITION_SHIFT));
+        }
+
+        if (best == NULL || cost < best_cost)
+        {
+            best = &candidates[i];
+            best_cost = cost;
+        }
+    }
+
+    if (best != NULL)
+    {
+        if (!track->id)
+        {
+            // new line, the identifier 0 is kept for "no line"
+            track->last_id = (track->last_id == UINT8_MAX) ? 1 : track->last_id + 1;
+            track->id = track->last_id;
+        }
+        track->line = *best;
+        track->confidence = (track->confidence + TRACK_CONFIDENCE_GAIN > TRACK_MAX_CONFIDENCE) ? TRACK_MAX_CONFIDENCE
+                                                                                             : track->confidence + TRACK_CONFIDENCE_GAIN;
+    }
+    else if (track->id)
+    {
+        // the line is missing: keeps the last position with less confidence
+        if (track->confidence > TRACK_CONFIDENCE_LOSS)
+        {
+            track->confidence -= TRACK_CONFIDENCE_LOSS;
+        }
+        else
+        {
+            track->id = 0;
+            track->confidence = 0;
+        }
+    }
+
+    if (!track->id)
+    {
+        // no line tracked, the position is update to it's initial value
+        track->line = (line_candidate_t){.position = (IMAGE_BUFFER_SIZE / 2) << LINE_POSITION_SHIFT}; // center
+    }
+}
+
+
+/*
+ *  Fills the array "candidates" with the dark segments of the buffer wider than
+ *  MIN_LINE_WIDTH, from left to right, and returns their number.
+ *  Each pixel is compared to an intensity threshold: a segment begins
+ *  when two pixels at a distance of WIDTH_SLOPE from each other are on the
+ *  opposite side of the threshold (descending slope) and ends on the opposite
+ *  ascending slope. Therefore the camera detected a line of lower intensity
+ *  compared to the threshold (mean of the buffer, or see select_threshold_mode).
+ *  The buffer is scanned only once, without going back after a
+ *  segment too narrow, so the processing time does not depend on the image:
+ *  every pixel costs the same constant work (one iteration per pixel).
+ *  The intensity of the segment is accumulated during the scan to compute its
+ *  contrast and its centroid without an additional pass. Each pixel of the
+ *  segment is weighted by (threshold - intensity), so the darkest part of the line
+ *  counts the most and the position is given with sub-pixel precision.
+ *  With a subsampled image, the slope and the width of the line are scaled
+ *  down and the candidates are given in full resolution pixels.
+ *
+ *  params:
+ *  const uint8_t *buffer   Pointer to the buffer containing the intensity of
+ *                          the pixel of the detected color.
+ *  uint16_t size           Number of pixels of the buffer.
+ *  uint8_t subsampling     Horizontal subsampling of the buffer (1, 2 or 4).
+ *  uint32_t threshold      Intensity separating the line from the background.
+ *  line_candidate_t *candidates    Array of MAX_LINE_CANDIDATES candidates to fill.
+ */
+uint8_t find_line_candidates(const uint8_t *buffer, uint16_t size, uint8_t subsampling, uint32_t threshold,
+                             line_candidate_t *candidates)
+{
+    uint16_t width_slope = WIDTH_SLOPE / subsampling;
+    uint16_t min_line_width = MIN_LINE_WIDTH / subsampling;
+    uint8_t nb_candidates = 0;
+    uint16_t begin = 0;
+    bool in_segment = false;
+    // sum of the intensity of the pixels of the current segment
+    uint32_t segment_sum = 0;
+    // sum of the weights (threshold - intensity) of the pixels of the segment and of the weighted positions
+    uint32_t weight_sum = 0, weighted_position_sum = 0;
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (in_segment)
+        {
+            segment_sum += buffer[i];
+            if (buffer[i] < threshold)
+            {
+                weight_sum += threshold - buffer[i];
+                weighted_position_sum += (threshold - buffer[i]) * i;
+            }
+            // search for an end (ascending slope)
+            // the beginning of the slope must be lower in intensity than the threshold, and the end of the slope higher
+            if (i > width_slope && buffer[i] > threshold && buffer[i - width_slope] < threshold)
+            {
+                in_segment = false;
+                // segments too small are ignored, the search continues from this pixel
+                if ((i - begin) >= min_line_width && nb_candidates < MAX_LINE_CANDIDATES)
+                {
+                    line_candidate_t *candidate = &candidates[nb_candidates++];
+                    // mean intensity of the segment, from begin to end included
+                    uint32_t segment_mean = segment_sum / (i - begin + 1);
+
+                    candidate->begin = begin * subsampling;
+                    candidate->end = i * subsampling;
+                    candidate->width = (i - begin) * subsampling;
+                    candidate->contrast = (segment_mean < threshold) ? (uint8_t)(threshold - segment_mean) : 0;
+                    if (weight_sum)
+                    {
+                        candidate->position = ((weighted_position_sum << LINE_POSITION_SHIFT) / weight_sum) * subsampling;
+                    }
+                    else
+                    {
+                        candidate->position = ((begin + i) << (LINE_POSITION_SHIFT - 1)) * subsampling;
+                    }
+                }
+            }
+        }
+        // search for a begin (descending slope), it can start where the previous segment ended
+        // the beginning of the slope must be higher in intensity than the threshold, and the end of the slope lower
+        if (!in_segment && i < (size - width_slope) && buffer[i] > threshold && buffer[i + width_slope] < threshold)
+        {
+            begin = i;
+            segment_sum = buffer[i];
+            weight_sum = 0;
+            weighted_position_sum = 0;
+            in_segment = true;
+        }
+    }
+    return nb_candidates;
+}
+
+
+/*
+ *  Returns the intensity of the red channel of a RGB565 pixel, on 8 bits.
+ *
+ *  params:
+ *  uint8_t msb             First byte of the pixel (big-endian format).
+ *  uint8_t lsb             Second byte of the pixel.
+ */
+static inline uint8_t extract_red(uint8_t msb, uint8_t lsb)
+{
+    (void)lsb;
+    return msb & 0xF8;
+}
+
+/*
+ *  Returns the intensity of the green channel of a RGB565 pixel, on 8 bits.
+ *
+ *  params:
+ *  uint8_t msb             First byte of the pixel (big-endian format).
+ *  uint8_t lsb             Second byte of the pixel.
+ */
+static inline uint8_t extract_green(uint8_t msb, uint8_t lsb)
+{
+    // extracts 3 LSbits of the first byte and the 3 MSbits of second byte
+    return ((msb & 0x07) << 5) + ((lsb & 0xE0) >> 3);
+}
+
+/*
+ *  Returns the intensity of the blue channel of a RGB565 pixel, on 8 bits.
+ *
+ *  params:
+ *  uint8_t msb             First byte of the pixel (big-endian format).
+ *  uint8_t lsb             Second byte of the pixel.
+ */
+static inline uint8_t extract_blue(uint8_t msb, uint8_t lsb)
+{
+    (void)msb;
+    // extracts 5 LSbits of the LSByte (Second byte in big-endian format)
+    return (lsb & 0x1F) << 3;
+}
+
+/*
+ *  Returns the intensity of a RGB565 pixel classified by color: 0 if its class
+ *  is dark for the color detected, otherwise 255. The class is read from the
+ *  table in flash and masked with the bits of the dark classes in the same step.
+ *
+ *  params:
+ *  uint8_t msb             First byte of the pixel (big-endian format).
+ *  uint8_t lsb             Second byte of the pixel.
+ *  uint8_t dark_classes    Bits of the classes dark for the color detected (CLASS_DARK_IN_...).
+ */
+static inline uint8_t classify_pixel(uint8_t msb, uint8_t lsb, uint8_t dark_classes)
+{
+    // index on 15 bits: 5 bits of red, 5 MSbits of green, 5 bits of blue
+    uint16_t index = ((((msb << 8) | lsb) >> 6) << 5) | (lsb & 0x1F);
+    return ((class_table[index >> 2] >> ((index & 0x03) * 2)) & dark_classes) ? 0 : 255;
+}
+
+/*
+ *  Returns the intensity of a RGB565 pixel classified by color, when the red,
+ *  green or blue color is detected.
+ *
+ *  params:
+ *  uint8_t msb             First byte of the pixel (big-endian format).
+ *  uint8_t lsb             Second byte of the pixel.
+ */
+static inline uint8_t extract_class_red(uint8_t msb, uint8_t lsb)
+{
+    return classify_pixel(msb, lsb, CLASS_DARK_IN_RED);
+}
+
+static inline uint8_t extract_class_green(uint8_t msb, uint8_t lsb)
+{
+    return classify_pixel(msb, lsb, CLASS_DARK_IN_GREEN);
+}
+
+static inline uint8_t extract_class_blue(uint8_t msb, uint8_t lsb)
+{
+    return classify_pixel(msb, lsb, CLASS_DARK_IN_BLUE);
+}
+
+/*
+ *  Fills the buffer "image" with the intensity of one color channel, averaged
+ *  over COMBINED_LINES lines of the RGB565 image, and returns the sum
+ *  of the intensities (used by line_detection for the mean, without another pass).
+ *  The histogram of the intensities is updated in the same pass.
+ *  The extract function is a constant at every call, so the compiler inlines it
+ *  and each color gets its own loop as before.
+ *
+ *  params:
+ *  const uint8_t *img_buff_ptr     First line to combine of the image captured in RGB565,
+ *                                  lines of "size" pixels.
+ *  uint8_t *image                  Buffer of "size" pixels to fill.
+ *  uint16_t *histogram             Histogram of the intensities (HISTOGRAM_SIZE bins), cleared before.
+ *  uint16_t size                   Number of pixels of a line.
+ *  extract                         Function extracting the channel of a pixel.
+ */
+static inline uint32_t extract_lines(const uint8_t *img_buff_ptr, uint8_t *image, uint16_t *histogram, uint16_t size,
+                                     uint8_t (*extract)(uint8_t msb, uint8_t lsb))
+{
+    uint32_t image_sum = 0;
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        uint16_t pixel_sum = 0;
+        for (uint8_t line = 0; line < COMBINED_LINES; line++)
+        {
+            const uint8_t *pixel = &img_buff_ptr[2 * (line * size + i)];
+            pixel_sum += extract(pixel[0], pixel[1]);
+        }
+        image[i] = pixel_sum / COMBINED_LINES;
+        image_sum += image[i];
+        histogram[image[i]]++;
+    }
+    return image_sum;
+}
+
+/*
+ *  Fills the buffer "image" with the luminance of the pixels, averaged over
+ *  COMBINED_LINES lines of the greyscale image (one byte per pixel),
+ *  and returns the sum of the intensities. The histogram of the intensities is
+ *  updated in the same pass.
+ *
+ *  params:
+ *  const uint8_t *img_buff_ptr     First line to combine of the image captured in greyscale,
+ *                                  lines of "size" pixels.
+ *  uint8_t *image                  Buffer of "size" pixels to fill.
+ *  uint16_t *histogram             Histogram of the intensities (HISTOGRAM_SIZE bins), cleared before.
+ *  uint16_t size                   Number of pixels of a line.
+ */
+uint32_t extract_grey_lines(const uint8_t *img_buff_ptr, uint8_t *image, uint16_t *histogram, uint16_t size)
+{
+    uint32_t image_sum = 0;
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        uint16_t pixel_sum = 0;
+        for (uint8_t line = 0; line < COMBINED_LINES; line++)
+        {
+            pixel_sum += img_buff_ptr[line * size + i];
+        }
+        image[i] = pixel_sum / COMBINED_LINES;
+        image_sum += image[i];
+        histogram[image[i]]++;
+    }
+    return image_sum;
+}
+
+/*
+ *  Fills the buffer "image" with the intensity of the pixels of one line of the
+ *  RGB565 image for the color to detect, and returns the sum of the intensities.
+ *  The histogram is updated. With the classification, the line followed is dark
+ *  (see CLASS_DARK_IN_RED).
+ *
+ *  params:
+ *  const uint8_t *img_buff_ptr     First line to combine of the image captured in RGB565,
+ *                                  lines of "size" pixels.
+ *  uint8_t *image                  Buffer of "size" pixels to fill.
+ *  uint16_t *histogram             Histogram of the intensities (HISTOGRAM_SIZE bins), cleared before.
+ *  uint16_t size                   Number of pixels of a line.
+ *  color_detection_t color         Color to detect.
+ *  bool classify                   The pixels are classified by color instead of using one channel.
+ */
+uint32_t extract_color_lines(const uint8_t *img_buff_ptr, uint8_t *image, uint16_t *histogram, uint16_t size,
+                             color_detection_t color, bool classify)
+{
+    if (classify)
+    {
+        switch (color)
+        {
+        case RED_COLOR:
+            // The blue line is dark
+            return extract_lines(img_buff_ptr, image, histogram, size, extract_class_red);
+        case GREEN_COLOR:
+            // Both lines are dark
+            return extract_lines(img_buff_ptr, image, histogram, size, extract_class_green);
+        case BLUE_COLOR:
+            // The red line is dark
+            return extract_lines(img_buff_ptr, image, histogram, size, extract_class_blue);
+        }
+    }
+    else
+    {
+        switch (color)
+        {
+        case RED_COLOR:
+            // Extracts only the red pixels
+            return extract_lines(img_buff_ptr, image, histogram, size, extract_red);
+        case GREEN_COLOR:
+            // Extracts only the green pixels
+            return extract_lines(img_buff_ptr, image, histogram, size, extract_green);
+        case BLUE_COLOR:
+            // Extracts only the blue pixels
+            return extract_lines(img_buff_ptr, image, histogram, size, extract_blue);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+#ifndef LINE_DETECTION_H
+#define LINE_DETECTION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ *  Extraction of the intensity of the pixels of a line of the image, detection
+ *  of the dark segments and tracking of the line from frame to frame. Works on
+ *  buffers only, without the camera nor ChibiOS, so it also builds on a computer
+ *  (see host/makefile).
+ */
+
+// number of pixel captured by the image for each line
+#define IMAGE_BUFFER_SIZE 640
+// number of captured lines averaged together to reduce the noise
+#define COMBINED_LINES 2
+// number of bins of the histogram of the intensities (8 bits)
+#define HISTOGRAM_SIZE 256
+// maximum number of line candidates kept for one image
+#define MAX_LINE_CANDIDATES 8
+// number of fractional bits of the sub-pixel positions (1/16 pixel)
+#define LINE_POSITION_SHIFT 4
+
+// List of detection color
+typedef enum
+{
+    RED_COLOR,
+    GREEN_COLOR,
+    BLUE_COLOR,
+} color_detection_t;
+
+// Dark segment of the image, wide enough to be a line
+typedef struct
+{
+    uint16_t begin;   // pixel where the descending slope begins
+    uint16_t end;     // pixel where the ascending slope ends
+    uint16_t width;   // in pixel
+    uint8_t contrast; // intensity threshold of the image minus mean intensity of the segment
+    uint16_t position; // centroid weighted by the darkness of the pixels, with LINE_POSITION_SHIFT fractional bits
+} line_candidate_t;
+
+// Line followed from frame to frame
+typedef struct
+{
+    uint8_t id;             // identifier of the track, 0 if no line is tracked
+    uint8_t confidence;     // from 0 to TRACK_MAX_CONFIDENCE, decreases when the line is missing
+    line_candidate_t line;  // last candidate associated with the track
+    uint8_t last_id;        // identifier of the last track started
+    bool reset;             // set to restart the tracking from the next frame
+} line_track_t;
+
+uint32_t extract_color_lines(const uint8_t *img_buff_ptr, uint8_t *image, uint16_t *histogram, uint16_t size,
+                             color_detection_t color, bool classify);
+uint32_t extract_grey_lines(const uint8_t *img_buff_ptr, uint8_t *image, uint16_t *histogram, uint16_t size);
+uint8_t find_line_candidates(const uint8_t *buffer, uint16_t size, uint8_t subsampling, uint32_t threshold,
+                             line_candidate_t *candidates);
+void track_line(line_track_t *track, const line_candidate_t *candidates, uint8_t nb_candidates);
+
+#endif /* LINE_DETECTION_H */
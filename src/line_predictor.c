@@ -0,0 +1,145 @@
+#include <ch.h>
+#include <hal.h>
+
+#include "image_processing.h"
+#include "line_predictor.h"
+#include "motion.h"
+
+// gains of the alpha-beta filter: correction of the position and of the drift by a new measure
+#define ALPHA 0.6f
+#define BETA 0.2f
+// displacement of the line in the image for a rotation of the robot of one radian (in pixel): the line
+// is seen VIEW_DISTANCE ahead of the center of rotation, more than the focal length of the camera alone
+#define PIXELS_PER_RADIAN (VIEW_DISTANCE * PIXELS_PER_MM)
+// number of control periods kept to compensate the age of the measures (10 ms each)
+#define HISTORY_SIZE 64
+
+// predicted position of the line (in pixel) and drift not explained by the motors (in pixel/s)
+static float position = IMAGE_BUFFER_SIZE / 2;
+static float drift = 0;
+// sum of all the predicted displacements, and its value at the last HISTORY_SIZE updates
+static float displacement = 0;
+static float displacement_history[HISTORY_SIZE];
+static systime_t time_history[HISTORY_SIZE];
+static uint8_t history_index = 0;
+static uint8_t history_count = 0;
+
+static systime_t last_update_time = 0;
+// time of the capture and track of the last measure used
+static systime_t last_measure_time = 0;
+static uint8_t last_track_id = 0;
+
+/*
+ *  Returns the predicted displacement of the line since the time given,
+ *  using the history of the predictions. Returns 0 if the time is older
+ *  than the history.
+ *
+ *  params:
+ *  systime_t time          Time of the capture of a measure.
+ */
+static float displacement_since(systime_t time)
+{
+    for (uint8_t i = 0; i < history_count; i++)
+    {
+        // from the newest to the oldest update
+        uint8_t index = (history_index + HISTORY_SIZE - 1 - i) % HISTORY_SIZE;
+        if ((int32_t)(time - time_history[index]) >= 0)
+        {
+            return displacement - displacement_history[index];
+        }
+    }
+    return 0;
+}
+
+/*
+ *  Alpha-beta filter predicting the position of the line between two frames of
+ *  the camera, to be called at each period of the control loop.
+ *  The prediction uses the speeds commanded to the motors since the last call:
+ *  a rotation of the robot moves the line in the opposite direction in the image.
+ *  The drift (curvature of the line, robot not aligned) is estimated from the
+ *  errors of prediction. When a new frame is processed, the prediction at the
+ *  time of its capture is compared to the measure, and the position and drift
+ *  are corrected by ALPHA and BETA times the error. The measure is not used as
+ *  the position of now, because the frame is older than the control loop.
+ *
+ *  params:
+ *  int16_t right_speed     Speed of the right motor since the last call (in step/s).
+ *  int16_t left_speed      Speed of the left motor since the last call (in step/s).
+ */
+void line_predictor_update(int16_t right_speed, int16_t left_speed)
+{
+    systime_t now = chVTGetSystemTime();
+    float dt = ST2MS(now - last_update_time) / 1000.0f;
+    last_update_time = now;
+    line_measure_t line;
+    get_line_measure(&line);
+
+    if (!line.found)
+    {
+        last_track_id = 0;
+        position = IMAGE_BUFFER_SIZE / 2;
+        drift = 0;
+        return;
+    }
+
+    // rotation speed of the robot, positive clockwise (in rad/s)
+    float rotation_speed = (left_speed - right_speed) * STEP_DISTANCE / WHEEL_DISTANCE;
+    float step = (drift - rotation_speed * PIXELS_PER_RADIAN) * dt;
+    position += step;
+    displacement += step;
+    displacement_history[history_index] = displacement;
+    time_history[history_index] = now;
+    history_index = (history_index + 1) % HISTORY_SIZE;
+    history_count = (history_count < HISTORY_SIZE) ? history_count + 1 : HISTORY_SIZE;
+
+    systime_t measure_time = line.timestamp;
+    float measure = (float)line.position / (1 << LINE_POSITION_SHIFT);
+
+    if (line.id != last_track_id)
+    {
+        // new line: starts from the measure
+        last_track_id = line.id;
+        last_measure_time = measure_time;
+        position = measure + displacement_since(measure_time);
+        drift = 0;
+    }
+    else if (measure_time != last_measure_time)
+    {
+        float measure_period = ST2MS(measure_time - last_measure_time) / 1000.0f;
+        // error between the measure and the position predicted at the time of the capture
+        float error = measure - (position - displacement_since(measure_time));
+
+        position += ALPHA * error;
+        if (measure_period > 0)
+        {
+            drift += BETA * error / measure_period;
+        }
+        last_measure_time = measure_time;
+    }
+}
+
+/*
+ *  Returns the predicted position of the line, in fixed point with
+ *  LINE_POSITION_SHIFT fractional bits like get_line_position_fine().
+ */
+uint16_t line_predictor_get_position(void)
+{
+    if (position < 0)
+    {
+        return 0;
+    }
+    else if (position > IMAGE_BUFFER_SIZE - 1)
+    {
+        return (IMAGE_BUFFER_SIZE - 1) << LINE_POSITION_SHIFT;
+    }
+    return position * (1 << LINE_POSITION_SHIFT);
+}
+
+/*
+ *  Returns the drift of the line in the image not explained by the rotation
+ *  of the robot (in pixel/s), positive towards the right of the image.
+ */
+float line_predictor_get_drift(void)
+{
+    return drift;
+}
@@ -0,0 +1,10 @@
+#ifndef LINE_PREDICTOR_H
+#define LINE_PREDICTOR_H
+
+#include <stdint.h>
+
+void line_predictor_update(int16_t right_speed, int16_t left_speed);
+uint16_t line_predictor_get_position(void);
+float line_predictor_get_drift(void);
+
+#endif /* LINE_PREDICTOR_H */
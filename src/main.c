@@ -2,6 +2,10 @@
 #include "audio_processing.h"
 #include "image_processing.h"
 #include "motion.h"
+#include "tof_ranging.h"
+#ifdef BENCHMARK
+#include "benchmark.h"
+#endif
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -13,9 +17,9 @@
 #include <motors.h>
 #include <audio/microphone.h>
 #include <arm_math.h>
-#include <sensors/VL53L0X/VL53L0X.h>
 #include <leds.h>
 #include <camera/po8030.h>
+#include <chprintf.h>
 // In order to be able to use the RGB LEDs and User button
 // These funtcions are handled by the ESP32 and the communication with the uC is done via SPI
 #include <spi_comm.h>
@@ -25,6 +29,29 @@ uintptr_t __stack_chk_guard = STACK_CHK_GUARD;
 // number of rgb leds
 #define NUM_LEDS 4
 
+// Settings of the firmware, given by the makefile (e.g. "make CAPTURE_MODE=CAPTURE_LOOKAHEAD")
+// capture mode of the camera (see capture_mode_t)
+#ifndef CAPTURE_MODE
+#define CAPTURE_MODE CAPTURE_RGB565
+#endif
+// seconds in each capture mode before the next one, to measure them all (see get_capture_benchmark),
+// 0 to keep CAPTURE_MODE
+#ifndef CAPTURE_MODE_CYCLE
+#define CAPTURE_MODE_CYCLE 0
+#endif
+// method of the threshold of the line detection (see threshold_mode_t)
+#ifndef THRESHOLD_MODE
+#define THRESHOLD_MODE THRESHOLD_MEAN
+#endif
+// control of the exposure from the intensity of the paper, 0 for the automatic exposure of the sensor
+#ifndef AUTO_EXPOSURE
+#define AUTO_EXPOSURE 1
+#endif
+// change of the ranging mode of the TOF with the distance to the goal, 0 for the long range mode only
+#ifndef RANGING_SCHEDULE
+#define RANGING_SCHEDULE 1
+#endif
+
 static FSM_STATE previous_state = 0;
 static FSM_STATE state = 0;
 // to iterate on to access the different RGB LEDS
@@ -102,6 +129,199 @@ void clear_rgb_leds(void)
 	set_all_rgb_leds(0, 0, 0);
 }
 
+// the reports would be mixed with the frames sent over USB (see image_processing.c)
+#ifndef CAPTURE
+/*
+ *	Sends over USB the frame rate of the camera and the latency of each stage of
+ *	the line following since the capture of the frame (minimum, mean, 99th
+ *	percentile and maximum, in us), measured during the last second, followed
+ *	by the measures of each capture mode used since the start.
+ *	Nothing is sent while the robot does not follow a line or the USB is not connected.
+ */
+static void report_camera_timing(void)
+{
+	static const char *stage_names[NB_PIPELINE_STAGES] = {"extraction", "detection", "command"};
+	static uint32_t buckets[LATENCY_BUCKETS];
+	latency_report_t latency[NB_PIPELINE_STAGES];
+	// frame rate in tenths of frame per second, chprintf does not print floats
+	uint16_t frame_rate = get_frame_rate() * 10;
+	capture_benchmark_t benchmark;
+
+	for (pipeline_stage_t stage = 0; stage < NB_PIPELINE_STAGES; stage++)
+	{
+		get_pipeline_latency(stage, &latency[stage], buckets);
+	}
+	if (latency[STAGE_COMMAND].count && SDU1.config->usbp->state == USB_ACTIVE)
+	{
+		chprintf((BaseSequentialStream *)&SDU1, "camera: %d.%d fps, latency since capture (min/mean/p99/max us):\r\n",
+				 frame_rate / 10, frame_rate % 10);
+		for (pipeline_stage_t stage = 0; stage < NB_PIPELINE_STAGES; stage++)
+		{
+			chprintf((BaseSequentialStream *)&SDU1, "  %s: %d/%d/%d/%d (%d samples)\r\n", stage_names[stage],
+					 latency[stage].min, latency[stage].mean, latency[stage].p99, latency[stage].max, latency[stage].count);
+		}
+
+		for (capture_mode_t mode = 0; mode < NB_CAPTURE_MODES; mode++)
+		{
+			get_capture_benchmark(mode, &benchmark);
+			if (benchmark.frames)
+			{
+				chprintf((BaseSequentialStream *)&SDU1, "  mode %d: frame %d ms, process %d us, lines found %d%%, jitter %d px\r\n",
+						 mode, (int)benchmark.frame_period_ms, (int)benchmark.process_time_us,
+						 (int)(100 * benchmark.lines_found / benchmark.frames), (int)benchmark.position_jitter);
+			}
+		}
+	}
+}
+
+/*
+ *	Sends over USB the duration of each stage of the detection of a string
+ *	(minimum, mean and maximum, in us), for each string detected since the
+ *	start, followed by the 99th percentile and the histogram of the time from the
+ *	start of the window to the decision ("smallest duration of the bucket:count").
+ *	Nothing is sent if no window was analyzed since the previous report.
+ */
+static void report_audio_timing(void)
+{
+	static const char *stage_names[NB_AUDIO_STAGES] = {"fill", "fft", "magnitude", "classification", "decision"};
+	static uint32_t previous_windows = 0;
+	static uint32_t buckets[LATENCY_BUCKETS];
+	latency_report_t latency, decision;
+	uint32_t windows = 0;
+
+	for (GUITAR_STRING string = FIRST_STRING; string <= NO_STRING; string++)
+	{
+		get_audio_latency(string, AUDIO_STAGE_DECISION, &latency, NULL);
+		windows += latency.count;
+	}
+	if (windows == previous_windows || SDU1.config->usbp->state != USB_ACTIVE)
+	{
+		return;
+	}
+	previous_windows = windows;
+
+	for (GUITAR_STRING string = FIRST_STRING; string <= NO_STRING; string++)
+	{
+		get_audio_latency(string, AUDIO_STAGE_DECISION, &decision, buckets);
+		if (decision.count == 0)
+		{
+			continue;
+		}
+		chprintf((BaseSequentialStream *)&SDU1, "audio string %d: %d windows (min/mean/max us)\r\n",
+				 (string == NO_STRING) ? 0 : string, decision.count);
+		for (AUDIO_STAGE stage = 0; stage < NB_AUDIO_STAGES; stage++)
+		{
+			get_audio_latency(string, stage, &latency, NULL);
+			chprintf((BaseSequentialStream *)&SDU1, "  %s: %d/%d/%d\r\n", stage_names[stage],
+					 latency.min, latency.mean, latency.max);
+		}
+		chprintf((BaseSequentialStream *)&SDU1, "  decision p99 %d us, histogram:", decision.p99);
+		for (uint8_t i = 0; i < LATENCY_BUCKETS; i++)
+		{
+			if (buckets[i])
+			{
+				chprintf((BaseSequentialStream *)&SDU1, " %d:%d", latency_bucket_start(i), buckets[i]);
+			}
+		}
+		chprintf((BaseSequentialStream *)&SDU1, "\r\n");
+	}
+}
+
+/*
+ *	Sends over USB the mean time to reach a goal distance, the mean and maximum
+ *	distance to the goal when reached and the largest overshoot, with and without
+ *	change of the ranging mode of the TOF, when a new goal was reached.
+ *	A TOF which did not answer is reported once: no goal can be reached.
+ */
+static void report_approaches(void)
+{
+	static uint16_t previous_approaches = 0;
+	static bool tof_failure_reported = false;
+	approach_stats_t stats[2];
+
+	if (tof_ranging_failed() && !tof_failure_reported && SDU1.config->usbp->state == USB_ACTIVE)
+	{
+		chprintf((BaseSequentialStream *)&SDU1, "approach: the TOF does not answer, no distance is measured\r\n");
+		tof_failure_reported = true;
+	}
+	get_approach_stats(false, &stats[0]);
+	get_approach_stats(true, &stats[1]);
+	if (stats[0].approaches + stats[1].approaches == previous_approaches || SDU1.config->usbp->state != USB_ACTIVE)
+	{
+		return;
+	}
+	previous_approaches = stats[0].approaches + stats[1].approaches;
+
+	for (uint8_t scheduled = 0; scheduled < 2; scheduled++)
+	{
+		if (stats[scheduled].approaches)
+		{
+			// in tenths of mm, chprintf does not print floats
+			uint32_t error = 10 * stats[scheduled].error_mm / stats[scheduled].approaches;
+			chprintf((BaseSequentialStream *)&SDU1, "approach %s: %d goals, mean %d ms, error mean %d.%d mm max %d mm, overshoot max %d mm\r\n",
+					 scheduled ? "scheduled ranging" : "long range", stats[scheduled].approaches,
+					 stats[scheduled].time_ms / stats[scheduled].approaches, error / 10, error % 10,
+					 stats[scheduled].max_error_mm, stats[scheduled].max_overshoot_mm);
+		}
+	}
+}
+#endif
+
+#ifdef BENCHMARK
+// number of runs measured for each kernel
+#define BENCHMARK_SAMPLES 100
+
+/*
+ *	Returns the realtime counter: the cycle counter of the DWT.
+ */
+static uint32_t benchmark_cycles(void)
+{
+	return chSysGetRealtimeCounterX();
+}
+
+/*
+ *	Measures the kernels of benchmark.c and sends the cycles of one call of
+ *	each kernel over USB, as CSV lines (compared with a baseline by src/host/benchmark -c).
+ */
+static void report_benchmarks(void)
+{
+	benchmark_result_t result;
+
+	if (SDU1.config->usbp->state != USB_ACTIVE)
+	{
+		return;
+	}
+	chprintf((BaseSequentialStream *)&SDU1, "kernel,unit,samples,min,mean,bytes\r\n");
+	for (uint8_t kernel = 0; kernel < benchmark_count(); kernel++)
+	{
+		benchmark_run(kernel, BENCHMARK_SAMPLES, benchmark_cycles, &result);
+		// chprintf does not print floats, the cycles are rounded
+		chprintf((BaseSequentialStream *)&SDU1, "%s,cycles,%d,%d,%d,%d\r\n", result.name, result.samples,
+				 (uint32_t)(result.min + 0.5f), (uint32_t)(result.mean + 0.5f), result.bytes);
+	}
+}
+#endif
+
+#if CAPTURE_MODE_CYCLE > 0
+/*
+ *	Selects the next capture mode every CAPTURE_MODE_CYCLE calls, one per
+ *	second, so the measures of get_capture_benchmark cover every mode.
+ */
+static void cycle_capture_mode(void)
+{
+	static uint16_t seconds = 0;
+	static capture_mode_t mode = CAPTURE_MODE;
+
+	if (++seconds < CAPTURE_MODE_CYCLE)
+	{
+		return;
+	}
+	seconds = 0;
+	mode = (mode + 1) % NB_CAPTURE_MODES;
+	select_capture_mode(mode);
+}
+#endif
+
 int main(void)
 {
 	halInit();
@@ -114,17 +334,30 @@ int main(void)
 	serial_start();
 	// starts the USB communication
 	usb_start();
+#ifdef BENCHMARK
+	// only the benchmarks run, the other threads would disturb the measures
+	benchmark_init();
+	while (1)
+	{
+		chThdSleepSeconds(5);
+		report_benchmarks();
+	}
+#endif
 	// starts the camera
 	dcmi_start();
 	po8030_start();
 	// init color detection mode of the camera
 	select_color_detection(BLUE_COLOR);
+	select_capture_mode(CAPTURE_MODE);
+	select_threshold_mode(THRESHOLD_MODE);
+	select_auto_exposure(AUTO_EXPOSURE);
 	// inits the motors
 	motors_init();
 	// starts RGB LEDS and User button managment
 	spi_comm_start();
-	// inits time of flight
-	VL53L0X_start();
+	// inits time of flight, its ranging mode is chosen by the motion
+	tof_ranging_start();
+	select_ranging_schedule(RANGING_SCHEDULE);
 	// starts the microphones processing thread. It calls the callback given in parameter when samples are ready
 	mic_start(&processAudioData);
 	// stars the threads for the pi regulator
@@ -135,6 +368,14 @@ int main(void)
 	while (1)
 	{
 		chThdSleepSeconds(1);
+#if CAPTURE_MODE_CYCLE > 0
+		cycle_capture_mode();
+#endif
+#ifndef CAPTURE
+		report_camera_timing();
+		report_audio_timing();
+		report_approaches();
+#endif
 	}
 }
 
@@ -142,8 +383,3 @@ void __stack_chk_fail(void)
 {
 	chSysHalt("Stack smashing detected");
 }
-
-void __stack_chk_fail(void)
-{
-	chSysHalt("Stack smashing detected");
-}
\ No newline at end of file
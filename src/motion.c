@@ -1,27 +1,59 @@
 #include <ch.h>
 #include <hal.h>
+#include <stdlib.h>
 #include <math.h>
 #include <arm_math.h>
 #include <usbcfg.h>
 #include <motors.h>
-#include <sensors/VL53L0X/VL53L0X.h>
 
 #include "audio_processing.h"
 #include "image_processing.h"
+#include "line_predictor.h"
+#include "pid.h"
+#include "motion_profile.h"
+#include "distance_estimator.h"
+#include "tof_ranging.h"
 #include "motion.h"
 #include "main.h"
 
-#define SPEED_MOTORS 400
-#define TOF_PRECISION 5 // in [mm]
-#define ERROR_THRESHOLD 10
-#define MAX_ERROR 150
-#define KP 0.5f // proportional constant
-
-#define STEPS_FOR_90_ROTATION 30
-#define STEPS_FOR_180_ROTATION 60
-#define ROTATION_180 1
-#define ROTATION_90 0
-#define ROTATION_CLOCKWISE 1
+// cruise speed and acceleration of the approach of a goal distance, and cruise speed backward,
+// where the camera is behind the robot (in steps/s and steps/s^2)
+#define APPROACH_SPEED 400
+#define APPROACH_ACCELERATION 600
+#define REVERSE_SPEED 300
+// distance to the goal under which the TOF measures with a high accuracy, and above which
+// it measures at a high speed again (in mm)
+#define ACCURACY_DISTANCE 20
+#define SPEED_DISTANCE 40
+#define TOF_PRECISION 3 // in [mm]
+// period of the line tracking loop (in [ms])
+#define CONTROL_PERIOD 10
+// correction added per pixel/line of heading of the line ahead (feed-forward, look-ahead mode only)
+#define HEADING_FEED_FORWARD 40
+// reduction of the speed per pixel/line^2 of curvature of the line ahead beyond the noise of the
+// curvature measured on a straight line (subsampled by 4, about 1e-3 pixel/line^2), and maximal reduction
+#define CURVATURE_NOISE 0.002f
+#define CURVATURE_SLOWDOWN 2000
+#define MAX_SLOWDOWN 0.5f
+// reduction of the speed when a junction is ahead
+#define JUNCTION_SLOWDOWN 0.5f
+// distance over which the offset of the robot from the line is corrected when going backward (in mm)
+#define REVERSE_RESPONSE 65.0f
+// search of a lost line (see search_line): speed (in steps/s), steps of the straight motion, steps of each
+// wheel added to the rotation every two sweeps (30 deg), number of sweeps (up to 90 deg on each side),
+// and number of searches before giving up
+#define SEARCH_SPEED 300
+#define SEARCH_STEPS 200
+#define SEARCH_TURN_STEPS (STEPS_FOR_90_ROTATION / 3)
+#define SEARCH_SWEEPS (2 * STEPS_FOR_90_ROTATION / SEARCH_TURN_STEPS)
+#define SEARCH_ATTEMPTS 3
+
+// steps of each wheel for a rotation on itself: quarter of the perimeter of the circle
+// of diameter WHEEL_DISTANCE (53 mm), 0.13 mm per step
+#define STEPS_FOR_90_ROTATION 320
+// acceleration and deceleration of the rotations (in steps/s^2), and speed at the start and the end (in steps/s)
+#define ROTATION_ACCELERATION 4000
+#define ROTATION_MIN_SPEED 100
 
 // distance between the center line and the walls 1 and 3
 #define CENTER_TO_WALL 229
@@ -36,7 +68,60 @@ static uint16_t string_distance[] = {106, 161, 216, 269, 317, 367};
 static bool line_detected = 0;
 static bool distance_reached = false;
 static int16_t speed_correction = 0;
+// speeds commanded to the motors while following a line, used to predict the position of the line
+static int16_t right_speed = 0;
+static int16_t left_speed = 0;
 static WALL_FACED wall_faced = WALL_2;
+// search of the line while it is lost: straight motion or sweep in progress, position of the motors
+// at the start of the phase, direction of the rotation of the sweep and number of attempts
+static bool searching = false;
+static bool search_turning = false;
+static uint8_t search_sweep = 0;
+static int8_t search_direction = 0;
+static uint8_t search_attempts = 0;
+static int32_t search_left = 0;
+static int32_t search_right = 0;
+
+// steering on the position of the line (in pixel): the output is the difference of speed between the motors.
+// Errors under 10 pixels are ignored, the camera is a bit noisy, and the correction is at most 75 steps/s.
+static const pid_config_t steering_config = {
+    .kp = 0.5f,
+    .ki = 0.2f,
+    .kd = 0.02f,
+    .kff = HEADING_FEED_FORWARD,
+    .derivative_filter = 0.05f,
+    .deadband = 10,
+    .output_min = -75,
+    .output_max = 75,
+    .period = CONTROL_PERIOD / 1000.0f,
+};
+// tracking of the distance planned by the approach profile (in mm): the output is the speed of the motors,
+// the velocity of the profile is the feed-forward. No integral: the position is already the integral of the
+// speed, it would only overshoot. No derivative: it would oppose the velocity given by the feed-forward.
+static const pid_config_t distance_config = {
+    .kp = 15.0f,
+    .ki = 0,
+    .kd = 0,
+    .kff = 1.0f / STEP_DISTANCE,
+    .derivative_filter = 0,
+    .deadband = 0,
+    .output_min = -MOTOR_SPEED_LIMIT,
+    .output_max = MOTOR_SPEED_LIMIT,
+    .period = CONTROL_PERIOD / 1000.0f,
+};
+static pid_controller_t steering_pid;
+static pid_controller_t distance_pid;
+// distance to the wall planned from the current distance to the goal distance (in mm)
+static motion_profile_t approach_profile;
+
+// the ranging mode of the TOF changes with the distance to the goal, otherwise it stays in long range
+static bool ranging_schedule = true;
+// measures of the approaches, without [0] and with [1] ranging schedule
+static approach_stats_t approach_stats[2];
+// start of the current approach, and sign of the distance to the goal at the start
+static systime_t approach_start = 0;
+static int8_t approach_side = 0;
+static uint16_t approach_overshoot = 0;
 
 struct RGB
 {
@@ -57,23 +142,6 @@ struct RGB color_led_distance(int16_t distance_center)
     return param_rgb;
 }
 
-/*
- *	Simple sign function that returns:   1 if the number is positive
- *                                      -1 if the number is negative
- *                                       0 if the number is zero
- *	params :
- *	int16_t number		                 Signed number.
- */
-int8_t sign(int16_t number)
-{
-    if (number > 0)
-        return 1;
-    else if (number < 0)
-        return -1;
-    else
-        return 0;
-}
-
 /*
  *	Returns the wall currently faced by the TOF of the EPuck2.
  */
@@ -94,81 +162,347 @@ void set_wall_faced(WALL_FACED new_wall_faced)
 }
 
 /*
- *	Simple P regulator implementation: the speed is proportionnal
- *  to the error (distance - goal).
+ *  Commands the motors and keeps their speeds for the prediction of the position of the line.
  *
  *  params:
- *  uint16_t distance           Current distance measured.
- *  uint16_t goal               Goal distance.
+ *  int16_t right               Speed of the right motor (in steps/s).
+ *  int16_t left                Speed of the left motor (in steps/s).
  */
+static void set_motors_speed(int16_t right, int16_t left)
+{
+    right_speed = right;
+    left_speed = left;
+    right_motor_set_speed(right);
+    left_motor_set_speed(left);
+}
 
 void stop_motors(void)
 {
-    right_motor_set_speed(0);
-    left_motor_set_speed(0);
+    set_motors_speed(0, 0);
 }
-int16_t p_regulator(uint16_t distance, uint16_t goal)
+
+/*
+ *  Enables or disables the change of ranging mode of the TOF during the
+ *  approaches, to compare the approaches with and without (see get_approach_stats).
+ *
+ *  params:
+ *  bool enable                 Change of ranging mode with the distance to the goal.
+ */
+void select_ranging_schedule(bool enable)
 {
+    ranging_schedule = enable;
+}
 
-    int16_t error = 0;
-    int16_t speed = 0;
+/*
+ *  Copies the measures of the approaches done with or without change of the
+ *  ranging mode of the TOF, since the start.
+ *
+ *  params:
+ *  bool scheduled                  Approaches with change of ranging mode.
+ *  approach_stats_t *stats         Measures to fill.
+ */
+void get_approach_stats(bool scheduled, approach_stats_t *stats)
+{
+    chSysLock();
+    *stats = approach_stats[scheduled];
+    chSysUnlock();
+}
 
-    error = distance - goal;
+/*
+ *  Chooses the ranging mode of the TOF for the approach of a goal distance:
+ *  high speed while far from the goal, so the estimate of the distance is
+ *  corrected often while the robot moves fast, and high accuracy for the end
+ *  of the approach, where the robot is slow and the precision counts.
+ *  There is a hysteresis between the two, so the mode does not switch back
+ *  and forth. The change is done by the thread of the TOF.
+ *
+ *  params:
+ *  int16_t distance_diff       Distance to the goal (in mm).
+ */
+static void schedule_ranging(int16_t distance_diff)
+{
+    static ranging_mode_t mode = RANGING_LONG_RANGE;
 
-    // disables the P regulator if the error is to small, the camera is a bit noisy
-    if (abs(error) < ERROR_THRESHOLD)
+    if (!ranging_schedule)
     {
-        return 0;
+        mode = RANGING_LONG_RANGE;
     }
-    // we set a maximum and a minimum error
-    else if (error > MAX_ERROR)
+    else if (abs(distance_diff) < ACCURACY_DISTANCE)
     {
-        error = MAX_ERROR;
+        mode = RANGING_HIGH_ACCURACY;
     }
-    else if (error < -MAX_ERROR)
+    else if (abs(distance_diff) > SPEED_DISTANCE || mode == RANGING_LONG_RANGE)
     {
-        error = -MAX_ERROR;
+        mode = RANGING_HIGH_SPEED;
     }
+    tof_ranging_select_mode(mode);
+}
 
-    speed = KP * error;
+/*
+ *  Updates the measures of the current approach of a goal distance: the time
+ *  to reach the goal, the distance to the goal when reached and the largest
+ *  distance beyond the goal (overshoot).
+ *
+ *  params:
+ *  int16_t distance_diff       Distance to the goal (in mm).
+ *  bool reached                The goal is reached, the approach is finished.
+ */
+static void update_approach(int16_t distance_diff, bool reached)
+{
+    int8_t side = (distance_diff > 0) ? 1 : ((distance_diff < 0) ? -1 : 0);
+    if (approach_side == 0)
+    {
+        approach_side = side;
+    }
+    else if (side == -approach_side && abs(distance_diff) > approach_overshoot)
+    {
+        approach_overshoot = abs(distance_diff);
+    }
 
-    return speed;
+    if (reached)
+    {
+        approach_stats_t *stats = &approach_stats[ranging_schedule];
+        chSysLock();
+        stats->approaches++;
+        stats->time_ms += ST2MS(chVTGetSystemTime() - approach_start);
+        stats->error_mm += abs(distance_diff);
+        stats->max_error_mm = (abs(distance_diff) > stats->max_error_mm) ? abs(distance_diff) : stats->max_error_mm;
+        stats->max_overshoot_mm = (approach_overshoot > stats->max_overshoot_mm) ? approach_overshoot : stats->max_overshoot_mm;
+        chSysUnlock();
+    }
+}
+
+/*
+ *  Returns the speed of the motors to reach a distance from the wall faced,
+ *  positive to go forward (the distance is larger than the goal).
+ *  The distance follows a trapezoidal profile (accelerate, cruise, decelerate)
+ *  planned again from the estimate of the distance at each new measure of the
+ *  TOF, and the speed is the speed of the profile corrected by the error
+ *  between the planned distance and the estimate. The profile is stopped while
+ *  no line is detected: the speed then only gives the direction of the goal,
+ *  to search for the line (see search_line).
+ *
+ *  params:
+ *  float distance              Estimate of the distance (in mm, see distance_estimator).
+ *  bool new_measure            The estimate was corrected by a new measure of the TOF.
+ *  uint16_t goal               Goal distance (in mm).
+ */
+static int16_t distance_regulator(float distance, bool new_measure, uint16_t goal)
+{
+    if (!get_line_detection())
+    {
+        // the robot searches for the line (see line_tracking_while_condition): the profile
+        // is planned again from the distance when it is found instead of running ahead
+        motion_profile_stop(&approach_profile);
+        pid_reset(&distance_pid);
+        return (distance > goal) ? SEARCH_SPEED : -SEARCH_SPEED;
+    }
+    if (new_measure || goal != approach_profile.target || !approach_profile.planned)
+    {
+        // backward if the goal is further from the wall
+        approach_profile.max_velocity = ((goal > distance) ? REVERSE_SPEED : APPROACH_SPEED) * STEP_DISTANCE;
+        motion_profile_plan(&approach_profile, distance, goal);
+    }
+    // velocity of the distance, negative when going forward
+    float velocity = motion_profile_step(&approach_profile, CONTROL_PERIOD / 1000.0f);
+
+    return -(int16_t)pid_update(&distance_pid, approach_profile.position, distance, velocity);
+}
+
+/*
+ *  Returns true when the profile of the approach reached its goal: the robot
+ *  then stops on the goal instead of as soon as it enters the precision
+ *  around it, which would leave it at the edge of the precision.
+ */
+static bool approach_arrived(void)
+{
+    return approach_profile.planned && approach_profile.position == approach_profile.target;
+}
+
+/*
+ *  Returns the correction of the speed of the motors to follow the line backward.
+ *  The camera is then at the trailing end of the robot: steering on the position
+ *  of the line, as forward, would turn the front towards the line and push the
+ *  center away from it. The offset of the center from the line and the heading
+ *  of the robot are both corrected: the offset seen, e = offset + VIEW_DISTANCE * heading,
+ *  and the drift of the line, -speed * heading, give the rotation speed
+ *      rotation = speed * e / R^2 + drift * (2 / R + VIEW_DISTANCE / R^2)
+ *  which brings the offset back to the line with a critical damping over
+ *  R = REVERSE_RESPONSE, whatever the speed.
+ *
+ *  params:
+ *  float position              Predicted position of the line (in pixel).
+ *  int16_t speed               Speed of the robot along the line (in steps/s), negative.
+ */
+static int16_t reverse_steering(float position, int16_t speed)
+{
+    // in mm and mm/s
+    float offset = (position - IMAGE_BUFFER_SIZE / 2) / PIXELS_PER_MM;
+    float drift = line_predictor_get_drift() / PIXELS_PER_MM;
+    float velocity = -speed * STEP_DISTANCE;
+    // in rad/s, positive anticlockwise
+    float rotation = velocity * offset / (REVERSE_RESPONSE * REVERSE_RESPONSE) +
+                     drift * (2 / REVERSE_RESPONSE + VIEW_DISTANCE / (REVERSE_RESPONSE * REVERSE_RESPONSE));
+    float correction = rotation * WHEEL_DISTANCE / (2 * STEP_DISTANCE);
+
+    return (int16_t)fminf(fmaxf(correction, steering_config.output_min), steering_config.output_max);
+}
+
+/*
+ *  Searches for the line while it is lost, one control period per call. The
+ *  robot first moves straight on for SEARCH_STEPS in the direction of its goal,
+ *  the line may be hidden by a crossing, then it turns on itself to one side and
+ *  to the other, 30 deg further each time, up to 90 deg, and comes back to its
+ *  heading. After SEARCH_ATTEMPTS searches, the robot gives up and
+ *  the FSM goes to DO_NOTHING. The search stops as soon as the line is detected.
+ *
+ *  params:
+ *  int16_t speed               Speed of the robot along the line: its sign is the direction
+ *                              of the straight motion, none if 0.
+ */
+static void search_line(int16_t speed)
+{
+    if (!searching)
+    {
+        searching = true;
+        search_turning = (speed == 0);
+        search_sweep = 0;
+        search_direction = 0;
+        search_attempts = 0;
+        search_left = left_motor_get_pos();
+        search_right = right_motor_get_pos();
+    }
+    int32_t left = left_motor_get_pos() - search_left;
+    int32_t right = right_motor_get_pos() - search_right;
+
+    if (!search_turning)
+    {
+        if ((abs(left) + abs(right)) / 2 < SEARCH_STEPS)
+        {
+            int16_t straight_speed = (speed > 0) ? SEARCH_SPEED : -SEARCH_SPEED;
+            set_motors_speed(straight_speed, straight_speed);
+            return;
+        }
+        // the sweeps are measured from the heading at the end of the straight motion
+        search_turning = true;
+        search_left += left;
+        search_right += right;
+        left = 0;
+        right = 0;
+    }
+
+    // rotation to reach: SEARCH_TURN_STEPS more every two sweeps, alternately anticlockwise and clockwise,
+    // then back to the heading at the start of the sweeps
+    int32_t amplitude = (search_sweep / 2 + 1) * SEARCH_TURN_STEPS;
+    int32_t target = (search_sweep >= SEARCH_SWEEPS) ? 0 : ((search_sweep % 2) ? -amplitude : amplitude);
+    // rotation since the start of the sweeps, in steps of each wheel, positive anticlockwise
+    int32_t turn = (right - left) / 2;
+    int8_t direction = (target > turn) ? 1 : -1;
+
+    if (search_direction == 0)
+    {
+        search_direction = direction;
+    }
+    if (direction == search_direction && turn != target)
+    {
+        set_motors_speed(direction * SEARCH_SPEED, -direction * SEARCH_SPEED);
+        return;
+    }
+    // target reached
+    search_direction = 0;
+    if (search_sweep < SEARCH_SWEEPS)
+    {
+        search_sweep++;
+    }
+    else if (++search_attempts < SEARCH_ATTEMPTS)
+    {
+        // moves on again from the heading of the start
+        search_turning = (speed == 0);
+        search_sweep = 0;
+        search_left = left_motor_get_pos();
+        search_right = right_motor_get_pos();
+    }
+    else
+    {
+        stop_motors();
+        searching = false;
+        clear_rgb_leds();
+        set_FSM_state(DO_NOTHING);
+    }
 }
 
 /*
  *  Tracks and follow a line detected by the camera while the parameter "condition" is false.
  *  When the condition is reached (condition = true) motors are stopped.
+ *  The robot steers on the position of the line predicted at each call from the
+ *  speeds commanded, corrected when the camera gives a new position. Backward,
+ *  the steering corrects the heading of the robot too (see reverse_steering).
+ *  While no line is detected, the robot searches for it (see search_line).
  *
  *  params:
  *  bool condition                Condition to stop the EPuck2:  if false the EPuck2 tracks the line.
  *                                                               if true the EPuck2 stops.
- *  int8_t direction              Direction of the EPuck2:       1 is forward.
- *                                                              -1 is backward.
+ *  int16_t speed                 Speed of the EPuck2 along the line (in steps/s): positive is forward.
+ *                                While no line is detected, only its sign is used.
  */
-void line_tracking_while_condition(bool condition, int8_t direction)
+void line_tracking_while_condition(bool condition, int16_t speed)
 {
     if (!condition)
     {
         // search for a line
         line_detected = get_line_detection();
+        // position of the line now, from the speeds commanded since the last call
+        line_predictor_update(right_speed, left_speed);
 
         if (line_detected)
         {
-            // computes a correction factor to let the robot rotate to be in front of the line
-            speed_correction = p_regulator(get_line_position(), (IMAGE_BUFFER_SIZE / 2));
+            // anticipates the curves and junctions seen ahead when moving forward
+            float heading = 0;
+            lookahead_t line_ahead;
+            get_lookahead(&line_ahead);
+            if (line_ahead.valid && speed > 0)
+            {
+                // a line going to the right ahead needs a negative correction, like a line on the right
+                heading = -line_ahead.heading;
+                float slowdown = fminf(fmaxf(fabsf(line_ahead.curvature) - CURVATURE_NOISE, 0) * CURVATURE_SLOWDOWN, MAX_SLOWDOWN);
+                if (line_ahead.junction)
+                {
+                    slowdown = fmaxf(slowdown, JUNCTION_SLOWDOWN);
+                }
+                speed = (int16_t)(speed * (1.0f - slowdown));
+            }
 
-            right_motor_set_speed(direction * SPEED_MOTORS - speed_correction);
-            left_motor_set_speed(direction * SPEED_MOTORS + speed_correction);
+            searching = false;
+            // computes a correction factor to let the robot rotate to be in front of the line
+            float position = (float)line_predictor_get_position() / (1 << LINE_POSITION_SHIFT);
+            if (speed < 0)
+            {
+                speed_correction = reverse_steering(position, speed);
+                pid_reset(&steering_pid);
+            }
+            else
+            {
+                speed_correction = pid_update(&steering_pid, IMAGE_BUFFER_SIZE / 2, position, heading);
+            }
+            set_motors_speed(speed + speed_correction, speed - speed_correction);
+            // age of the frame used for this command
+            record_pipeline_latency(STAGE_COMMAND, get_line_cycles());
         }
-        // if no line found, motors are turned off
+        // if no line found, the robot searches for it
         else
         {
-            stop_motors();
+            search_line(speed);
+            pid_reset(&steering_pid);
         }
     }
     else // stop the motors
     {
         stop_motors();
+        searching = false;
+        pid_reset(&steering_pid);
+        // the prediction keeps following the measures while the robot is stopped, its drift
+        // would otherwise move the line at the next start
+        line_predictor_update(0, 0);
     }
 }
 
@@ -188,26 +522,49 @@ static THD_FUNCTION(LineTracking, arg)
     // difference between the measured distance and the goal distance
     int16_t distance_diff = 0;
     FSM_STATE current_state = 0;
+    FSM_STATE previous_state = DO_NOTHING;
 
     while (1)
     {
         current_state = get_FSM_state();
         distance_diff = 0;
+        if (current_state != previous_state)
+        {
+            // new goal distance, the robot starts from stop, maybe facing another wall
+            pid_reset(&distance_pid);
+            motion_profile_stop(&approach_profile);
+            distance_estimator_reset();
+            searching = false;
+            previous_state = current_state;
+            approach_start = chVTGetSystemTime();
+            approach_side = 0;
+            approach_overshoot = 0;
+        }
+        // the TOF is sampled once per period, fused with the odometry
+        bool new_measure = distance_estimator_update();
+        float distance = distance_estimator_get_distance();
+        bool approaching = (current_state == STRING_POSITION || current_state == FREQUENCY_POSITION ||
+                            current_state == STRING_CENTER);
 
-        if (current_state == STRING_POSITION)
+        if (approaching && !distance_estimator_ready())
+        {
+            // no measure of the wall faced yet, the robot waits for the first one
+            line_tracking_while_condition(true, 0);
+        }
+        else if (current_state == STRING_POSITION)
         {
             set_all_rgb_leds(MAX_LED_INTENSITY, 0, MAX_LED_INTENSITY);
             distance_reached = false;
             // difference between the measured distance and the distance of the current string
-            distance_diff = VL53L0X_get_dist_mm() - string_distance[get_guitar_string() - 1];
-            if (abs(distance_diff) <= TOF_PRECISION)
+            distance_diff = distance - string_distance[get_guitar_string() - 1];
+            if (abs(distance_diff) <= TOF_PRECISION && approach_arrived())
             {
                 distance_reached = true;
                 clear_rgb_leds();
                 increment_FSM_state();
             }
             // if the distance is not reached, follow the line
-            line_tracking_while_condition(distance_reached, sign(distance_diff));
+            line_tracking_while_condition(distance_reached, distance_regulator(distance, new_measure, string_distance[get_guitar_string() - 1]));
         }
         else if (current_state == FREQUENCY_POSITION)
         {
@@ -219,25 +576,21 @@ static THD_FUNCTION(LineTracking, arg)
                 // distance converted. Now the distance is from the WALL_3
                 distance_frequency = CENTER_TO_WALL * 2 - distance_frequency;
             }
-            set_all_rgb_leds(color_led_distance(MAX_LED_INTENSITY - VL53L0X_get_dist_mm()).r_value, color_led_distance(MAX_LED_INTENSITY - VL53L0X_get_dist_mm()).g_value, 0);
+            struct RGB led_color = color_led_distance(MAX_LED_INTENSITY - distance);
+            set_all_rgb_leds(led_color.r_value, led_color.g_value, 0);
             // difference between the measured distance and the distance to the wall
-            distance_diff = VL53L0X_get_dist_mm() - distance_frequency;
+            distance_diff = distance - distance_frequency;
 
-            if (distance_diff >= 2 * TOF_PRECISION)
+            if (abs(distance_diff) >= 2 * TOF_PRECISION || !approach_arrived())
             {
-                // the goal distance is in front of the robot -> follow the line
-                line_tracking_while_condition(distance_reached, 1);
-            }
-            else if (distance_diff <= -2 * TOF_PRECISION)
-            {
-                // the goal distance is behind the robot -> 180deg rotation
-                set_FSM_state(ROTATION);
+                // follow the line, backward if the goal distance is behind the robot
+                line_tracking_while_condition(distance_reached, distance_regulator(distance, new_measure, distance_frequency));
             }
             else // the robot reached his goal
             {
                 distance_reached = true;
                 // stop the robot
-                line_tracking_while_condition(distance_reached, 1);
+                line_tracking_while_condition(distance_reached, 0);
                 // ready to detect a new frequency
                 clear_rgb_leds();
                 set_FSM_state(FREQUENCY_DETECTION);
@@ -248,113 +601,118 @@ static THD_FUNCTION(LineTracking, arg)
             set_all_rgb_leds(MAX_LED_INTENSITY, 0, MAX_LED_INTENSITY);
             distance_reached = false;
             // difference between the measured distance and the center line
-            distance_diff = VL53L0X_get_dist_mm() - CENTER_TO_WALL;
+            distance_diff = distance - CENTER_TO_WALL;
 
-            if (distance_diff >= TOF_PRECISION)
-            {
-                // the goal distance is in front of the robot -> follow the line
-                line_tracking_while_condition(distance_reached, 1);
-            }
-            else if (distance_diff <= -TOF_PRECISION)
+            if (abs(distance_diff) >= TOF_PRECISION || !approach_arrived())
             {
-                // the goal distance is behind the robot -> 180deg rotation
-                set_FSM_state(ROTATION);
+                // follow the line, backward if the goal distance is behind the robot
+                line_tracking_while_condition(distance_reached, distance_regulator(distance, new_measure, CENTER_TO_WALL));
             }
             else // the robot reached his goal
             {
                 distance_reached = true;
                 // stop the robot
-                line_tracking_while_condition(distance_reached, 1);
+                line_tracking_while_condition(distance_reached, 0);
                 // 90deg rotation to face de WALL_2
                 set_FSM_state(ROTATION);
             }
         }
+        if (approaching && distance_estimator_ready())
+        {
+            update_approach(distance_diff, distance_reached);
+            schedule_ranging(distance_diff);
+        }
+        else
+        {
+            tof_ranging_select_mode(RANGING_LONG_RANGE);
+        }
         // 100Hz
-        chThdSleepMilliseconds(10);
+        chThdSleepMilliseconds(CONTROL_PERIOD);
     }
 }
 
 /*
- *  Handle the rotation of the robot depending on the previous state of the FSM.
+ *  Performs one period of a rotation of the robot on itself, and returns true
+ *  when the rotation is finished and the motors are stopped.
+ *  The rotation is measured with the step counters of the motors, from their
+ *  position at the first call of the rotation, so it does not depend on the
+ *  timing of the calls. The speed follows a profile: it accelerates from
+ *  ROTATION_MIN_SPEED at ROTATION_ACCELERATION, up to MOTOR_SPEED_LIMIT, and
+ *  decelerates at the same rate to stop on the last step (v = sqrt(2 * a * d)).
  *
  *  params:
- *  bool angle_degree               Angle of the rotation performed by the EPuck2: true is 180deg
- *                                                                                 false is 90deg
- *  bool clockwise                  Rotation direction: true is clocwise
- *                                                      false is anticlockwise
- *  FSM_STATE prev_state            Previous state of the FSM.
+ *  int32_t steps               Steps of each wheel for the rotation.
+ *  bool clockwise              Rotation direction: true is clockwise.
  */
-void rotation_robot(bool angle_degree, bool clockwise, FSM_STATE prev_state)
+static bool rotate(int32_t steps, bool clockwise)
 {
-    static uint8_t steps_done = 0;
-    if (angle_degree) // rotation 180°
+    static bool rotating = false;
+    static int32_t start_left = 0;
+    static int32_t start_right = 0;
+    static float speed = 0;
+    static systime_t last_time = 0;
+
+    systime_t time = chVTGetSystemTime();
+    if (!rotating)
     {
-        right_motor_set_speed(-MOTOR_SPEED_LIMIT);
-        left_motor_set_speed(MOTOR_SPEED_LIMIT);
-        steps_done++;
-
-        if (steps_done >= STEPS_FOR_180_ROTATION)
-        {
-            stop_motors();
-            steps_done = 0;
-            // set the new wall faced: WALL_1 if previous was WALL_3, and viceversa
-            set_wall_faced((wall_faced + 2) % 4);
-
-            switch (prev_state)
-            {
-            case FREQUENCY_POSITION:
-                chThdSleepMilliseconds(150);
-                increment_FSM_state();
-                break;
-            case STRING_CENTER:
-                chThdSleepMilliseconds(150);
-                set_FSM_state(STRING_CENTER);
-                break;
-            default:
-                clear_rgb_leds();
-                set_FSM_state(DO_NOTHING);
-            }
-        }
+        start_left = left_motor_get_pos();
+        start_right = right_motor_get_pos();
+        speed = ROTATION_MIN_SPEED;
+        last_time = time;
+        rotating = true;
     }
-    else // rotation 90°
+
+    // mean of the steps done by the two wheels
+    int32_t steps_done = (abs(left_motor_get_pos() - start_left) + abs(right_motor_get_pos() - start_right)) / 2;
+    int32_t steps_left = steps - steps_done;
+    if (steps_left <= 0)
     {
-        if (clockwise)
-        {
-            right_motor_set_speed(-MOTOR_SPEED_LIMIT);
-            left_motor_set_speed(MOTOR_SPEED_LIMIT);
-            steps_done++;
-        }
-        else
-        {
-            right_motor_set_speed(MOTOR_SPEED_LIMIT);
-            left_motor_set_speed(-MOTOR_SPEED_LIMIT);
-            steps_done++;
-        }
+        stop_motors();
+        rotating = false;
+        return true;
+    }
 
-        if (steps_done >= STEPS_FOR_90_ROTATION)
-        {
-            stop_motors();
-            steps_done = 0;
+    float dt = ST2MS(time - last_time) / 1000.0f;
+    last_time = time;
+    // acceleration, limited by the speed from which the robot can stop on the remaining steps
+    speed = fminf(speed + ROTATION_ACCELERATION * dt, MOTOR_SPEED_LIMIT);
+    speed = fminf(speed, sqrtf(2.0f * ROTATION_ACCELERATION * steps_left));
+    speed = fmaxf(speed, ROTATION_MIN_SPEED);
+
+    int16_t wheel_speed = clockwise ? (int16_t)speed : -(int16_t)speed;
+    right_motor_set_speed(-wheel_speed);
+    left_motor_set_speed(wheel_speed);
+    return false;
+}
 
-            switch (prev_state)
-            {
-            case STRING_POSITION:
-                select_color_detection(RED_COLOR);
-                clockwise ? set_wall_faced(WALL_3) : set_wall_faced(WALL_1);
-                chThdSleepMilliseconds(150);
-                clear_rgb_leds();
-                increment_FSM_state();
-                break;
-            case STRING_CENTER:
-                select_color_detection(BLUE_COLOR);
-                set_wall_faced(WALL_2);
-                chThdSleepMilliseconds(150);
-                set_FSM_state(STRING_POSITION);
-                break;
-            default:
-                clear_rgb_leds();
-                set_FSM_state(DO_NOTHING);
-            }
+/*
+ *  Handle the rotation of 90deg of the robot depending on the previous state of the FSM.
+ *
+ *  params:
+ *  bool clockwise                  Rotation direction: true is clocwise
+ *                                                      false is anticlockwise
+ *  FSM_STATE prev_state            Previous state of the FSM.
+ */
+static void rotation_robot(bool clockwise, FSM_STATE prev_state)
+{
+    if (rotate(STEPS_FOR_90_ROTATION, clockwise))
+    {
+        switch (prev_state)
+        {
+        case STRING_POSITION:
+            select_color_detection(RED_COLOR);
+            clockwise ? set_wall_faced(WALL_3) : set_wall_faced(WALL_1);
+            clear_rgb_leds();
+            increment_FSM_state();
+            break;
+        case STRING_CENTER:
+            select_color_detection(BLUE_COLOR);
+            set_wall_faced(WALL_2);
+            set_FSM_state(STRING_POSITION);
+            break;
+        default:
+            clear_rgb_leds();
+            set_FSM_state(DO_NOTHING);
         }
     }
 }
@@ -383,26 +741,12 @@ static THD_FUNCTION(Rotation, arg)
             case STRING_POSITION:
                 set_all_rgb_leds(MAX_LED_INTENSITY, MAX_LED_INTENSITY, 0);
                 // rotation of 90deg, clocwise or anticlockwise depending on the pitch of the frequency
-                rotation_robot(ROTATION_90, get_pitch(), previous_state);
-                break;
-            case FREQUENCY_POSITION:
-                set_all_rgb_leds(MAX_LED_INTENSITY, MAX_LED_INTENSITY, 0);
-                // clocwise rotation of 180deg, the goal distance is behind the robot.
-                rotation_robot(ROTATION_180, ROTATION_CLOCKWISE, previous_state);
+                rotation_robot(get_pitch(), previous_state);
                 break;
             case STRING_CENTER:
-                if (distance_reached)
-                {
-                    set_all_rgb_leds(0, MAX_LED_INTENSITY, 0);
-                    // the robot is at the center. Rotation of 90deg to face the WALL_2
-                    rotation_robot(ROTATION_90, wall_faced % 3, previous_state);
-                }
-                else
-                {
-                    set_all_rgb_leds(0, MAX_LED_INTENSITY, 0);
-                    // clocwise rotation of 180deg, the goal distance is behind the robot.
-                    rotation_robot(ROTATION_180, ROTATION_CLOCKWISE, previous_state);
-                }
+                set_all_rgb_leds(0, MAX_LED_INTENSITY, 0);
+                // the robot is at the center. Rotation of 90deg to face the WALL_2
+                rotation_robot(wall_faced % 3, previous_state);
                 break;
             default:
                 clear_rgb_leds();
@@ -420,6 +764,9 @@ static THD_FUNCTION(Rotation, arg)
  */
 void motion_start(void)
 {
+    pid_init(&steering_pid, &steering_config);
+    pid_init(&distance_pid, &distance_config);
+    motion_profile_init(&approach_profile, APPROACH_SPEED * STEP_DISTANCE, APPROACH_ACCELERATION * STEP_DISTANCE);
     chThdCreateStatic(waLineTracking, sizeof(waLineTracking), NORMALPRIO, LineTracking, NULL);
     chThdCreateStatic(waRotation, sizeof(waRotation), NORMALPRIO, Rotation, NULL);
 }
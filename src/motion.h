@@ -1,6 +1,14 @@
 #ifndef MOTION_H
 #define MOTION_H
 
+#include <stdint.h>
+#include <stdbool.h>
+
+// distance travelled by a wheel for one step of the motor (in mm)
+#define STEP_DISTANCE 0.13f
+// distance between the two wheels (in mm)
+#define WHEEL_DISTANCE 53.0f
+
 // wall faced by the TOF of the EPuck2
 typedef enum
 {
@@ -11,6 +19,18 @@ typedef enum
 
 } WALL_FACED;
 
+// Measures of the approaches of a goal distance, with or without change of the ranging mode of the TOF
+typedef struct
+{
+    uint16_t approaches;    // number of goal distances reached
+    uint32_t time_ms;       // total time from the start of the approach to the goal
+    uint32_t error_mm;      // total absolute distance to the goal when reached
+    uint16_t max_error_mm;
+    uint16_t max_overshoot_mm; // largest distance beyond the goal during an approach
+} approach_stats_t;
+
+void select_ranging_schedule(bool enable);
+void get_approach_stats(bool scheduled, approach_stats_t *stats);
 void motion_start(void);
 
 #endif /* MOTION_H */
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <math.h>
+
+#include "motion_profile.h"
+
+/*
+ *  Initializes a profile with its limits, without plan.
+ *
+ *  params:
+ *  motion_profile_t *profile       Profile to initialize.
+ *  float max_velocity              Velocity of the cruise segment.
+ *  float acceleration              Acceleration and deceleration of the profile.
+ */
+void motion_profile_init(motion_profile_t *profile, float max_velocity, float acceleration)
+{
+    profile->max_velocity = max_velocity;
+    profile->acceleration = acceleration;
+    motion_profile_stop(profile);
+}
+
+/*
+ *  Plans the profile from a measured position to a target. The velocity planned
+ *  is kept, so the profile can be planned again at each new measure without
+ *  jerk: only the first plan after a stop starts from a null velocity.
+ *
+ *  params:
+ *  motion_profile_t *profile       Profile to plan.
+ *  float position                  Measured position.
+ *  float target                    Position to reach.
+ */
+void motion_profile_plan(motion_profile_t *profile, float position, float target)
+{
+    if (!profile->planned)
+    {
+        profile->velocity = 0;
+        profile->planned = true;
+    }
+    profile->position = position;
+    profile->target = target;
+}
+
+/*
+ *  Stops the profile: the next plan starts from a null velocity.
+ *
+ *  params:
+ *  motion_profile_t *profile       Profile to stop.
+ */
+void motion_profile_stop(motion_profile_t *profile)
+{
+    profile->velocity = 0;
+    profile->planned = false;
+}
+
+/*
+ *  Advances the profile by one period and returns the velocity planned.
+ *  The segments are chosen online from the remaining distance: the profile
+ *  decelerates as soon as the distance needed to stop (v^2 / 2a) reaches the
+ *  remaining distance, otherwise it accelerates up to max_velocity and cruises.
+ *  Short moves give a triangular profile. A profile going away from the target
+ *  (target moved behind) first decelerates, then comes back.
+ *
+ *  params:
+ *  motion_profile_t *profile       Profile advanced.
+ *  float dt                        Period (in [s]).
+ */
+float motion_profile_step(motion_profile_t *profile, float dt)
+{
+    float remaining = profile->target - profile->position;
+    float direction = (remaining >= 0) ? 1.0f : -1.0f;
+    float dv = profile->acceleration * dt;
+    // velocity towards the target
+    float velocity = direction * profile->velocity;
+    float stopping_distance = velocity * velocity / (2 * profile->acceleration);
+
+    if (velocity > 0 && stopping_distance >= fabsf(remaining))
+    {
+        velocity -= dv;
+    }
+    else
+    {
+        velocity = fminf(velocity + dv, profile->max_velocity);
+    }
+    // velocity from which the profile can still stop on the target
+    velocity = fminf(velocity, sqrtf(2 * profile->acceleration * fabsf(remaining)));
+
+    float step = velocity * dt;
+    if (velocity >= 0 && step >= fabsf(remaining) && velocity <= dv)
+    {
+        // target reached at the end of the deceleration
+        profile->position = profile->target;
+        profile->velocity = 0;
+        return 0;
+    }
+    profile->velocity = direction * velocity;
+    profile->position += profile->velocity * dt;
+    return profile->velocity;
+}
+
@@ -0,0 +1,22 @@
+#ifndef MOTION_PROFILE_H
+#define MOTION_PROFILE_H
+
+#include <stdbool.h>
+
+// Trapezoidal velocity profile from a position to a target, on one axis
+typedef struct
+{
+    float max_velocity; // in [unit/s]
+    float acceleration; // in [unit/s^2], also the deceleration
+    float target;
+    float position;     // position planned for now
+    float velocity;     // velocity planned for now, signed
+    bool planned;       // false until the first plan, or after a stop
+} motion_profile_t;
+
+void motion_profile_init(motion_profile_t *profile, float max_velocity, float acceleration);
+void motion_profile_plan(motion_profile_t *profile, float position, float target);
+void motion_profile_stop(motion_profile_t *profile);
+float motion_profile_step(motion_profile_t *profile, float dt);
+
+#endif /* MOTION_PROFILE_H */
@@ -0,0 +1,91 @@
+#include <math.h>
+
+#include "pid.h"
+
+/*
+ *  Initializes a controller with its configuration, which must stay valid
+ *  while the controller is used.
+ *
+ *  params:
+ *  pid_controller_t *pid           Controller to initialize.
+ *  const pid_config_t *config      Gains and limits of the controller.
+ */
+void pid_init(pid_controller_t *pid, const pid_config_t *config)
+{
+    pid->config = config;
+    pid_reset(pid);
+}
+
+/*
+ *  Clears the integral and the derivative, to call when the loop restarts
+ *  (new target, new measure source) so the past errors do not kick the output.
+ *
+ *  params:
+ *  pid_controller_t *pid           Controller to reset.
+ */
+void pid_reset(pid_controller_t *pid)
+{
+    pid->integral = 0;
+    pid->derivative = 0;
+    pid->previous_measure = 0;
+    pid->started = false;
+}
+
+/*
+ *  Computes the command of one period from the error (setpoint - measure):
+ *  kp * error + integral + kd * derivative + kff * feed_forward, limited to
+ *  [output_min, output_max].
+ *  The derivative is taken on the measure, so a change of setpoint does not
+ *  kick the output, and filtered by a first order low-pass filter, as the
+ *  measures are noisy and arrive slower than the updates.
+ *  Anti-windup: the integral stops growing while the output is saturated in
+ *  the direction of the error, so it does not overshoot once the error is reduced.
+ *
+ *  params:
+ *  pid_controller_t *pid           Controller updated.
+ *  float setpoint                  Value to reach.
+ *  float measure                   Measured value.
+ *  float feed_forward              Command known in advance (e.g. the planned speed).
+ */
+float pid_update(pid_controller_t *pid, float setpoint, float measure, float feed_forward)
+{
+    const pid_config_t *config = pid->config;
+    float error = setpoint - measure;
+
+    if (fabsf(error) < config->deadband)
+    {
+        error = 0;
+    }
+
+    if (!pid->started)
+    {
+        pid->previous_measure = measure;
+        pid->started = true;
+    }
+    // filtered derivative of the measure: alpha = T / (tau + T)
+    float alpha = config->period / (config->derivative_filter + config->period);
+    float derivative = (measure - pid->previous_measure) / config->period;
+    pid->derivative += alpha * (derivative - pid->derivative);
+    pid->previous_measure = measure;
+
+    float output = config->kp * error + pid->integral - config->kd * pid->derivative + config->kff * feed_forward;
+
+    if (output > config->output_max)
+    {
+        output = config->output_max;
+    }
+    else if (output < config->output_min)
+    {
+        output = config->output_min;
+    }
+    // integrates only if the output is not saturated, or if the error brings it back
+    bool saturated_high = (output >= config->output_max) && (error > 0);
+    bool saturated_low = (output <= config->output_min) && (error < 0);
+    if (!saturated_high && !saturated_low)
+    {
+        pid->integral += config->ki * error * config->period;
+        pid->integral = fminf(fmaxf(pid->integral, config->output_min), config->output_max);
+    }
+
+    return output;
+}
@@ -0,0 +1,34 @@
+#ifndef PID_H
+#define PID_H
+
+#include <stdbool.h>
+
+// Gains and limits of a PID controller called at a fixed rate
+typedef struct
+{
+    float kp;
+    float ki;                // in [1/s]
+    float kd;                // in [s]
+    float kff;               // gain of the feed-forward
+    float derivative_filter; // time constant of the low-pass filter of the derivative (in [s])
+    float deadband;          // errors smaller than this are ignored (sensor noise)
+    float output_min;
+    float output_max;
+    float period;            // period between two updates (in [s])
+} pid_config_t;
+
+// State of a PID controller
+typedef struct
+{
+    const pid_config_t *config;
+    float integral;
+    float derivative;
+    float previous_measure;
+    bool started; // false until the first update, or after a reset
+} pid_controller_t;
+
+void pid_init(pid_controller_t *pid, const pid_config_t *config);
+void pid_reset(pid_controller_t *pid);
+float pid_update(pid_controller_t *pid, float setpoint, float measure, float feed_forward);
+
+#endif /* PID_H */
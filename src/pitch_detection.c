@@ -0,0 +1,122 @@
+#include <arm_math.h>
+#include <arm_const_structs.h>
+
+#include "pitch_detection.h"
+
+// minimum value of intensity to detect a frequency
+#define MIN_INTENSITY_THRESHOLD 5000
+// we don't analyze before this index to not use resources for nothing
+#define MIN_INDEX 100
+// we don't analyze after this index to not use resources for nothing
+#define MAX_INDEX 500
+
+// frequency for each string of the guitar and their respective range
+#define SIXTH_STRING_FREQ_MIN 76
+#define SIXTH_STRING_FREQ 82.41f
+#define SIXTH_STRING_FREQ_MAX 88
+
+#define FIFTH_STRING_FREQ_MIN 103
+#define FIFTH_STRING_FREQ 110.00f
+#define FIFTH_STRING_FREQ_MAX 117
+
+#define FOURTH_STRING_FREQ_MIN 138
+#define FOURTH_STRING_FREQ 146.83f
+#define FOURTH_STRING_FREQ_MAX 156
+
+#define THIRD_STRING_FREQ_MIN 184
+#define THIRD_STRING_FREQ 196.00f
+#define THIRD_STRING_FREQ_MAX 208
+
+#define SECOND_STRING_FREQ_MIN 232
+#define SECOND_STRING_FREQ 246.94f
+#define SECOND_STRING_FREQ_MAX 262
+
+#define FIRST_STRING_FREQ_MIN 310
+#define FIRST_STRING_FREQ 329.63f
+#define FIRST_STRING_FREQ_MAX 350
+
+// float array containing the theoretical frequencies of each string of the guitar
+static const float string_frequency[] = {FIRST_STRING_FREQ, SECOND_STRING_FREQ, THIRD_STRING_FREQ, FOURTH_STRING_FREQ, FIFTH_STRING_FREQ, SIXTH_STRING_FREQ};
+
+/*
+ *	Wrapper to call a very optimized fft function provided by ARM.
+ *
+ *	params :
+ *	uint16_t size		        Size of the FFT must be equak to 1024.
+ *  float *complex_buffer       Input complex buffer to apply the FFT to.
+ */
+void doFFT_optimized(uint16_t size, float *complex_buffer)
+{
+    if (size == 1024)
+        arm_cfft_f32(&arm_cfft_sR_f32_len1024, complex_buffer, 0, 1);
+}
+
+/*
+ *	Returns the index associated at the frequency with the highest amplitude.
+ *
+ *	params :
+ *	const float *data	outupt buffer containing the computed magnitude
+ *                      of the complex numbers. Size: FTT_SIZE.
+ */
+uint16_t find_highest_peak(const float *data)
+{
+    float max_norm = MIN_INTENSITY_THRESHOLD;
+    int16_t max_norm_index = 0;
+
+    // search for the highest peak
+    for (uint16_t i = MIN_INDEX; i <= MAX_INDEX; i++)
+    {
+        if (data[i] > max_norm)
+        {
+            max_norm = data[i];
+            max_norm_index = i;
+        }
+    }
+    return max_norm_index;
+}
+
+/*
+ *	Search and return the string affiliated with a frequency.
+ *
+ *	params :
+ *	float frequency		Frequency detected (in Hz).
+ */
+GUITAR_STRING find_guitar_string(float frequency)
+{
+    if (frequency > SIXTH_STRING_FREQ_MIN && frequency < SIXTH_STRING_FREQ_MAX)
+    {
+        return SIXTH_STRING;
+    }
+    else if (frequency > FIFTH_STRING_FREQ_MIN && frequency < FIFTH_STRING_FREQ_MAX)
+    {
+        return FIFTH_STRING;
+    }
+    else if (frequency > FOURTH_STRING_FREQ_MIN && frequency < FOURTH_STRING_FREQ_MAX)
+    {
+        return FOURTH_STRING;
+    }
+    else if (frequency > THIRD_STRING_FREQ_MIN && frequency < THIRD_STRING_FREQ_MAX)
+    {
+        return THIRD_STRING;
+    }
+    else if (frequency > SECOND_STRING_FREQ_MIN && frequency < SECOND_STRING_FREQ_MAX)
+    {
+        return SECOND_STRING;
+    }
+    else if (frequency > FIRST_STRING_FREQ_MIN && frequency < FIRST_STRING_FREQ_MAX)
+    {
+        return FIRST_STRING;
+    }
+    return NO_STRING;
+}
+
+/*
+ *	Returns the theoretical frequency of a string (in Hz).
+ *
+ *	params :
+ *	GUITAR_STRING string	String, from FIRST_STRING to SIXTH_STRING.
+ */
+float guitar_string_frequency(GUITAR_STRING string)
+{
+    return string_frequency[string - 1];
+}
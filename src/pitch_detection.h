@@ -0,0 +1,35 @@
+#ifndef PITCH_DETECTION_H
+#define PITCH_DETECTION_H
+
+#include <stdint.h>
+
+/*
+ *  Detection of the pitch of a guitar string in a window of samples of one
+ *  microphone. Only depends on CMSIS-DSP (arm_math.h), so it also builds on a
+ *  computer with the reference sources of CMSIS-DSP or the portable fallback of
+ *  host/ (see host/makefile).
+ */
+
+#define FFT_SIZE 1024
+// frequency of one bin of the FFT (in Hz), calibrated on the robot
+#define FREQUENCY_PRECISION 0.765517
+
+// Different strings of the guitar
+typedef enum
+{
+    FIRST_STRING = 1,
+    SECOND_STRING,
+    THIRD_STRING,
+    FOURTH_STRING,
+    FIFTH_STRING,
+    SIXTH_STRING,
+    NO_STRING
+
+} GUITAR_STRING;
+
+void doFFT_optimized(uint16_t size, float *complex_buffer);
+uint16_t find_highest_peak(const float *data);
+GUITAR_STRING find_guitar_string(float frequency);
+float guitar_string_frequency(GUITAR_STRING string);
+
+#endif /* PITCH_DETECTION_H */
@@ -0,0 +1,171 @@
+#include <ch.h>
+#include <hal.h>
+#include <i2c_bus.h>
+#include <leds.h>
+#include <sensors/VL53L0X/VL53L0X.h>
+
+#include "tof_ranging.h"
+
+// Configuration of the VL53L0X for each ranging mode
+typedef struct
+{
+    VL53L0X_AccuracyMode accuracy;
+    uint16_t period;  // time between two polls of the data ready flag of the TOF (in [ms])
+    float variance;   // variance of a measure (in mm^2)
+} ranging_config_t;
+
+static const ranging_config_t ranging_configs[NB_RANGING_MODES] = {
+    // each measure is read at most 10 ms after its end
+    [RANGING_HIGH_SPEED] = {.accuracy = VL53L0X_HIGH_SPEED, .period = 10, .variance = 25.0f},
+    [RANGING_HIGH_ACCURACY] = {.accuracy = VL53L0X_HIGH_ACCURACY, .period = 25, .variance = 4.0f},
+    // read every 100 ms like VL53L0X_start
+    [RANGING_LONG_RANGE] = {.accuracy = VL53L0X_LONG_RANGE, .period = 100, .variance = 16.0f},
+};
+
+// mode asked and last measure
+static ranging_mode_t ranging_mode = RANGING_LONG_RANGE;
+static tof_measure_t last_measure = {.id = 0};
+// the TOF did not answer at its configuration, there will be no measure
+static bool tof_failed = false;
+
+/*
+ *  Asks a ranging mode. The TOF is reconfigured by its thread after the
+ *  current measure, so the caller does not wait for the I2C transfers.
+ *
+ *  params:
+ *  ranging_mode_t mode         Ranging mode.
+ */
+void tof_ranging_select_mode(ranging_mode_t mode)
+{
+    ranging_mode = mode;
+}
+
+/*
+ *  Copies the last measure of the TOF. A new measure has a new id.
+ *
+ *  params:
+ *  tof_measure_t *measure      Measure to fill.
+ */
+void tof_ranging_get_measure(tof_measure_t *measure)
+{
+    chSysLock();
+    *measure = last_measure;
+    chSysUnlock();
+}
+
+/*
+ *  Returns the variance of the measures of a ranging mode (in mm^2).
+ *
+ *  params:
+ *  ranging_mode_t mode         Ranging mode.
+ */
+float tof_ranging_get_variance(ranging_mode_t mode)
+{
+    return ranging_configs[mode].variance;
+}
+
+/*
+ *  Returns true if the TOF did not answer at its configuration: no measure
+ *  will be given, and the LED1 is on.
+ */
+bool tof_ranging_failed(void)
+{
+    return tof_failed;
+}
+
+/*
+ *  Configures the TOF in a ranging mode and starts its continuous ranging.
+ *  The timing budget of the measures is read back from the TOF, as set by
+ *  the accuracy of the mode.
+ *
+ *  params:
+ *  VL53L0X_Dev_t *device       TOF, stopped.
+ *  ranging_mode_t mode         Ranging mode.
+ *  uint32_t *budget_us         Timing budget of a measure to fill (in [us]).
+ */
+static VL53L0X_Error configure_ranging(VL53L0X_Dev_t *device, ranging_mode_t mode, uint32_t *budget_us)
+{
+    VL53L0X_Error status = VL53L0X_configAccuracy(device, ranging_configs[mode].accuracy);
+    if (status == VL53L0X_ERROR_NONE)
+    {
+        status = VL53L0X_GetMeasurementTimingBudgetMicroSeconds(device, budget_us);
+    }
+    if (status == VL53L0X_ERROR_NONE)
+    {
+        status = VL53L0X_startMeasure(device, VL53L0X_DEVICEMODE_CONTINUOUS_RANGING);
+    }
+    return status;
+}
+
+/*
+ *  Thread that configures the TOF in the mode asked and reads its measures,
+ *  in continuous ranging: the data ready flag is polled at the period of the
+ *  mode, and only a measure finished since the previous reading gets a new id,
+ *  then the flag is cleared for the next one. It replaces the thread of
+ *  the e-puck2 library (VL53L0X_start), which only has one configuration.
+ *  A change of mode stops the ranging, changes the timing budget and starts
+ *  the ranging again, between two readings.
+ */
+static THD_WORKING_AREA(waTofRanging, 512);
+static THD_FUNCTION(TofRanging, arg)
+{
+    chRegSetThreadName(__FUNCTION__);
+    (void)arg;
+
+    VL53L0X_Dev_t device;
+    device.I2cDevAddr = VL53L0X_ADDR;
+    ranging_mode_t configured_mode = ranging_mode;
+    uint32_t budget_us = 0;
+
+    // like VL53L0X_start, the I2C bus is started by the thread of the TOF
+    i2c_start();
+    VL53L0X_Error status = VL53L0X_init(&device);
+    if (status == VL53L0X_ERROR_NONE)
+    {
+        status = configure_ranging(&device, configured_mode, &budget_us);
+    }
+    if (status != VL53L0X_ERROR_NONE)
+    {
+        // the TOF does not answer: the approaches wait for a measure, the LED1 tells why
+        tof_failed = true;
+        set_led(LED1, 1);
+        return;
+    }
+
+    while (1)
+    {
+        systime_t time = chVTGetSystemTime();
+        uint8_t data_ready = 0;
+
+        if (VL53L0X_GetMeasurementDataReady(&device, &data_ready) == VL53L0X_ERROR_NONE && data_ready &&
+            VL53L0X_getLastMeasure(&device) == VL53L0X_ERROR_NONE)
+        {
+            VL53L0X_ClearInterruptMask(&device, 0);
+            chSysLock();
+            last_measure.distance_mm = device.Data.LastRangeMeasure.RangeMilliMeter;
+            last_measure.id++;
+            last_measure.mode = configured_mode;
+            last_measure.time = time;
+            // the measure ended at most one period before the reading
+            last_measure.start = time - MS2ST(ranging_configs[configured_mode].period + budget_us / 1000);
+            chSysUnlock();
+        }
+
+        if (ranging_mode != configured_mode)
+        {
+            configured_mode = ranging_mode;
+            VL53L0X_stopMeasure(&device);
+            configure_ranging(&device, configured_mode, &budget_us);
+        }
+
+        chThdSleepUntilWindowed(time, time + MS2ST(ranging_configs[configured_mode].period));
+    }
+}
+
+/*
+ *  Starts the thread TofRanging.
+ */
+void tof_ranging_start(void)
+{
+    chThdCreateStatic(waTofRanging, sizeof(waTofRanging), NORMALPRIO + 1, TofRanging, NULL);
+}
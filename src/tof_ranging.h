@@ -0,0 +1,29 @@
+#ifndef TOF_RANGING_H
+#define TOF_RANGING_H
+
+// Ranging modes of the TOF
+typedef enum
+{
+    RANGING_HIGH_SPEED = 0, // short timing budget: frequent measures, more noise
+    RANGING_HIGH_ACCURACY,  // long timing budget: precise measures, slower
+    RANGING_LONG_RANGE,     // mode of the e-puck2 library, for the states without approach
+    NB_RANGING_MODES,
+} ranging_mode_t;
+
+// Measure of the TOF
+typedef struct
+{
+    uint16_t distance_mm;
+    uint32_t id;         // incremented at each new measure, 0 before the first one
+    ranging_mode_t mode; // mode of the measure
+    systime_t time;      // time of the reading of the measure
+    systime_t start;     // earliest time at which the ranging of the measure may have started
+} tof_measure_t;
+
+void tof_ranging_start(void);
+void tof_ranging_select_mode(ranging_mode_t mode);
+void tof_ranging_get_measure(tof_measure_t *measure);
+float tof_ranging_get_variance(ranging_mode_t mode);
+bool tof_ranging_failed(void);
+
+#endif /* TOF_RANGING_H */